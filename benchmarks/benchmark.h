@@ -0,0 +1,96 @@
+#ifndef LIBMESH_BENCHMARK_H
+#define LIBMESH_BENCHMARK_H
+
+// libMesh includes
+#include <libmesh/libmesh_common.h>
+#include <libmesh/parallel.h>
+
+// C++ includes
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * The state passed to each benchmark: the communicator to run on,
+ * the size of the synthetic problem to build, and the timings
+ * recorded by measure().
+ */
+class BenchmarkState
+{
+public:
+  BenchmarkState (const libMesh::Parallel::Communicator & comm,
+                  unsigned int size,
+                  unsigned int n_warmup,
+                  unsigned int n_repeat);
+
+  const libMesh::Parallel::Communicator & comm () const { return _comm; }
+
+  /**
+   * The number of elements along each side of the synthetic meshes.
+   */
+  unsigned int size () const { return _size; }
+
+  /**
+   * Runs \p body n_warmup times untimed and then n_repeat times
+   * timed.  If \p setup is given it is run, untimed, before every
+   * call of \p body.  Each timing is the maximum over all processors,
+   * which are synchronized before every call.
+   */
+  void measure (const std::function<void()> & body,
+                const std::function<void()> & setup = std::function<void()>());
+
+  /**
+   * Sets the number of work items (elements, queries, ...) done by
+   * each call of the body, summed over processors, for reporting
+   * throughput.
+   */
+  void set_items_per_run (double items) { _items = items; }
+
+  double items_per_run () const { return _items; }
+
+  const std::vector<double> & times () const { return _times; }
+
+private:
+  const libMesh::Parallel::Communicator & _comm;
+  const unsigned int _size;
+  const unsigned int _n_warmup;
+  const unsigned int _n_repeat;
+  double _items;
+  std::vector<double> _times;
+};
+
+
+/**
+ * Summary statistics of a set of timings, in seconds.
+ */
+struct BenchmarkStatistics
+{
+  explicit BenchmarkStatistics (std::vector<double> times);
+
+  std::size_t n;
+  double min, max, mean, median, stddev;
+};
+
+
+typedef std::function<void(BenchmarkState &)> BenchmarkFunction;
+
+/**
+ * All benchmarks, by name.
+ */
+std::map<std::string, BenchmarkFunction> & benchmark_registry ();
+
+/**
+ * Adds a benchmark to the registry when constructed; declare these
+ * at file scope next to each benchmark.
+ */
+struct BenchmarkRegistration
+{
+  BenchmarkRegistration (const std::string & name,
+                         BenchmarkFunction function)
+  {
+    benchmark_registry()[name] = std::move(function);
+  }
+};
+
+#endif // LIBMESH_BENCHMARK_H
@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+
+# Compares two JSON files written by the libMesh benchmark driver,
+# e.g. from a release and from a candidate build:
+#
+#   ./compare_benchmarks.py baseline.json candidate.json [--threshold 0.1]
+#
+# Exits with status 1 if the median time of any benchmark common to
+# both files grew by more than the threshold fraction.
+
+import argparse
+import json
+import sys
+
+parser = argparse.ArgumentParser(description='Compare libMesh benchmark results')
+parser.add_argument('baseline')
+parser.add_argument('candidate')
+parser.add_argument('--threshold', type=float, default=0.1,
+                    help='allowed relative slowdown of the median time (default 0.1)')
+args = parser.parse_args()
+
+def load(filename):
+    with open(filename) as f:
+        data = json.load(f)
+    return data, {b['name']: b for b in data['benchmarks']}
+
+baseline_data, baseline = load(args.baseline)
+candidate_data, candidate = load(args.candidate)
+
+for key in ('size', 'n_processors', 'n_threads'):
+    if baseline_data[key] != candidate_data[key]:
+        print('Warning: %s differs (%s vs %s); timings may not be comparable'
+              % (key, baseline_data[key], candidate_data[key]))
+
+regressions = 0
+print('%-44s %12s %12s %9s' % ('Benchmark', 'baseline', 'candidate', 'change'))
+for name in sorted(set(baseline) & set(candidate)):
+    old = baseline[name]['median']
+    new = candidate[name]['median']
+    change = (new - old) / old if old > 0 else 0.
+    flag = ''
+    if change > args.threshold:
+        flag = '  REGRESSION'
+        regressions += 1
+    print('%-44s %12.3e %12.3e %+8.1f%%%s' % (name, old, new, 100 * change, flag))
+
+for name in sorted(set(baseline) ^ set(candidate)):
+    print('%-44s only in %s' % (name, args.baseline if name in baseline else args.candidate))
+
+sys.exit(1 if regressions else 0)
@@ -36,6 +36,7 @@
 
 // C++ Includes
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <iterator>
 #include <map>
@@ -1021,12 +1022,14 @@ public:
   {
     libmesh_assert(_stashed_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    this->invalidate_constraint_cache();
   }
 
   void unstash_dof_constraints()
   {
     libmesh_assert(_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    this->invalidate_constraint_cache();
   }
 
   /**
@@ -1044,6 +1047,7 @@ public:
   void swap_dof_constraints()
   {
     _dof_constraints.swap(_stashed_dof_constraints);
+    this->invalidate_constraint_cache();
   }
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -1765,6 +1769,61 @@ private:
                                            int qoi_index = -1,
                                            const bool called_recursively=false) const;
 
+  /**
+   * The constraint matrix C of a single element, stored sparsely, and
+   * the per-thread workspace which caches those matrices and holds
+   * the scratch space for applying them.  Both are defined in
+   * dof_map_constraints.C.
+   */
+  struct ElemConstraintMatrix;
+  struct ElemConstraintWorkspace;
+
+  /**
+   * \returns The workspace belonging to the calling thread.
+   */
+  static ElemConstraintWorkspace & elem_constraint_workspace();
+
+  /**
+   * \returns The sparse constraint matrix for the element degree of
+   * freedom indices \p elem_dofs, from the cache in \p ws if it has
+   * been built before since the constraints last changed, or
+   * \p nullptr if none of \p elem_dofs are constrained.
+   */
+  const ElemConstraintMatrix *
+  elem_constraint_matrix (const std::vector<dof_id_type> & elem_dofs,
+                          ElemConstraintWorkspace & ws) const;
+
+  /**
+   * Builds the sparse equivalent of build_constraint_matrix() and
+   * build_constraint_matrix_and_vector() in \p ecm.  The vector H is
+   * stored as weights of constraint values rather than as values, so
+   * the result is valid for every \p qoi_index and does not need to
+   * be rebuilt when only constraint values change.
+   */
+  void build_elem_constraint_matrix (ElemConstraintMatrix & ecm,
+                                     const std::vector<dof_id_type> & elem_dofs) const;
+
+  /**
+   * Computes C^T K C in \p matrix, and C^T (F - K H) in \p rhs if it
+   * is not null, where H is taken from \p rhs_values if that is not
+   * null.  \p elem_dofs is expanded to the dofs C maps onto.
+   */
+  void apply_elem_constraint_matrix (const ElemConstraintMatrix & ecm,
+                                     ElemConstraintWorkspace & ws,
+                                     DenseMatrix<Number> & matrix,
+                                     DenseVector<Number> * rhs,
+                                     const DofConstraintValueMap * rhs_values,
+                                     std::vector<dof_id_type> & elem_dofs) const;
+
+  /**
+   * Marks every cached element constraint matrix built for this
+   * DofMap as stale, and frees those cached by the calling thread.
+   * Must be called whenever \p _dof_constraints changes, other than
+   * through add_constraint_row(), which only bypasses the caches
+   * until the next call.
+   */
+  void invalidate_constraint_cache();
+
   /**
    * Finds all the DOFS associated with the element DOFs elem_dofs.
    * This will account for off-element couplings via hanging nodes.
@@ -1996,6 +2055,21 @@ private:
   DofConstraintValueMap      _primal_constraint_values;
 
   AdjointDofConstraintValues _adjoint_constraint_values;
+
+  /**
+   * Identifies the current state of \p _dof_constraints in the
+   * per-thread element constraint matrix caches.  Unique across all
+   * DofMap objects, and replaced by invalidate_constraint_cache().
+   */
+  std::atomic<unsigned long> _constraint_cache_id;
+
+  /**
+   * Set by add_constraint_row(), and cleared by
+   * invalidate_constraint_cache().  While it is set the element
+   * constraint matrix caches are bypassed, so that building
+   * constraints doesn't have to invalidate them for every row.
+   */
+  std::atomic<bool> _constraint_cache_dirty;
 #endif
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -31,16 +31,17 @@ namespace libMesh {
  * reducing header file dependencies.
  */
 enum ErrorEstimatorType : int {
-                         INVALID                 = -1,
-                         ADJOINT_REFINEMENT      =  0,
-                         ADJOINT_RESIDUAL        =  1,
-                         DISCONTINUITY_MEASURE   =  2,
-                         EXACT                   =  3,
-                         KELLY                   =  4,
-                         LAPLACIAN               =  5,
-                         PATCH_RECOVERY          =  6,
-                         WEIGHTED_PATCH_RECOVERY =  7,
-                         UNIFORM_REFINEMENT      =  8};
+                         INVALID                  = -1,
+                         ADJOINT_REFINEMENT       =  0,
+                         ADJOINT_RESIDUAL         =  1,
+                         DISCONTINUITY_MEASURE    =  2,
+                         EXACT                    =  3,
+                         KELLY                    =  4,
+                         LAPLACIAN                =  5,
+                         PATCH_RECOVERY           =  6,
+                         WEIGHTED_PATCH_RECOVERY  =  7,
+                         UNIFORM_REFINEMENT       =  8,
+                         PATCH_UNIFORM_REFINEMENT =  9};
 
 }
 
@@ -40,6 +40,8 @@ enum PartitionerType : int {
                       PARMETIS_PARTITIONER,
                       SUBDOMAIN_PARTITIONER,
                       MAPPED_SUBDOMAIN_PARTITIONER,
+                      DIFFUSIVE_PARTITIONER,
+                      HIERARCHICAL_PARTITIONER,
                       // Invalid
                       INVALID_PARTITIONER};
 
@@ -37,6 +37,7 @@ enum PointLocatorType : int {
                        TREE_ELEMENTS,
                        TREE_LOCAL_ELEMENTS,
                        NANOFLANN,
+                       BVH,
                        // Invalid
                        INVALID_LOCATOR};
 }
@@ -0,0 +1,188 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PATCH_UNIFORM_REFINEMENT_ESTIMATOR_H
+#define LIBMESH_PATCH_UNIFORM_REFINEMENT_ESTIMATOR_H
+
+// Local Includes
+#include "libmesh/error_estimator.h"
+#include "libmesh/patch.h"
+#include "libmesh/elem_range.h"
+
+#ifdef LIBMESH_ENABLE_AMR
+
+namespace libMesh
+{
+
+// Forward Declarations
+template <typename T> class DenseMatrix;
+template <typename T> class DenseVector;
+template <typename T> class FEGenericBase;
+typedef FEGenericBase<Real> FEBase;
+
+/**
+ * This class implements a local version of the
+ * UniformRefinementEstimator.  Instead of refining the whole mesh
+ * and solving the problem again globally, it builds a Patch around
+ * each element, refines an in-memory copy of the patch, and solves a
+ * small problem on the refined patch with Dirichlet values taken
+ * from the current solution on the patch boundary.  The error is the
+ * difference between the fine and coarse solutions, integrated over
+ * the element in the center of the patch.
+ *
+ * The mesh itself is never modified, and elements are processed in
+ * parallel across threads.  Because the global assembly of a System
+ * can't be run on a temporary patch, the element contributions to the
+ * local problems are supplied by the user as a LocalAssembly object.
+ * The local systems are solved with a dense LU factorization, so
+ * patches should be kept small.
+ *
+ * Only LAGRANGE variables and h refinement are currently supported.
+ * Each variable is solved for separately, so coupling between
+ * variables is not accounted for.
+ *
+ * \date 2023
+ * \brief Error estimator based on uniform refinement of local patches.
+ */
+class PatchUniformRefinementEstimator : public ErrorEstimator
+{
+public:
+
+  /**
+   * Abstract base class to be used for the element contributions to
+   * the local patch problems.
+   */
+  class LocalAssembly
+  {
+  public:
+    virtual ~LocalAssembly () = default;
+
+    /**
+     * Adds the contribution of one refined element to the local
+     * problem for variable \p var of \p system.  \p fe has been
+     * reinitialized on the refined element, with the shape functions,
+     * their gradients, the quadrature points and the JxW values
+     * precomputed.  \p coarse_elem is the element of the mesh which
+     * contains the refined element, e.g. for looking up subdomain or
+     * material data.  \p Ke and \p Fe have been sized and zeroed.
+     *
+     * This is called from several threads at once, so it must be
+     * thread safe.
+     */
+    virtual void assemble (const System & system,
+                           unsigned int var,
+                           const Elem & coarse_elem,
+                           const FEBase & fe,
+                           DenseMatrix<Number> & Ke,
+                           DenseVector<Number> & Fe) = 0;
+  };
+
+  /**
+   * Constructor.  Sets the most common default parameter values.
+   */
+  PatchUniformRefinementEstimator();
+
+  /**
+   * Copy/move ctor, copy/move assignment operator, and destructor are
+   * all explicitly defaulted for this simple class.
+   */
+  PatchUniformRefinementEstimator (const PatchUniformRefinementEstimator &) = default;
+  PatchUniformRefinementEstimator (PatchUniformRefinementEstimator &&) = default;
+  PatchUniformRefinementEstimator & operator= (const PatchUniformRefinementEstimator &) = default;
+  PatchUniformRefinementEstimator & operator= (PatchUniformRefinementEstimator &&) = default;
+  virtual ~PatchUniformRefinementEstimator() = default;
+
+  /**
+   * Attach the object which assembles the local patch problems.
+   * This must be done before the error is estimated.
+   */
+  void attach_local_assembly (LocalAssembly & assembly)
+  { _local_assembly = &assembly; }
+
+  /**
+   * This function solves a problem on a refined copy of the patch
+   * around each active local element, then estimates the error by
+   * integrating differences between the coarse and fine solutions.
+   * The L2, H1 seminorm and H1 norms are supported.
+   *
+   * The estimated error is output in the vector
+   * \p error_per_cell
+   */
+  virtual void estimate_error (const System & system,
+                               ErrorVector & error_per_cell,
+                               const NumericVector<Number> * solution_vector = nullptr,
+                               bool estimate_parent_error = false) override;
+
+  virtual ErrorEstimatorType type() const override;
+
+  /**
+   * Patches of at least this many elements will be built to solve
+   * the local problems on.
+   */
+  unsigned int target_patch_size;
+
+  /**
+   * The pointer to a Patch member function used when growing patches.
+   * The default strategy used is Patch::add_local_face_neighbors.
+   */
+  Patch::PMF patch_growth_strategy;
+
+  /**
+   * How many h refinements to perform to get the fine patch
+   */
+  unsigned char number_h_refinements;
+
+private:
+
+  /**
+   * Class to compute the error contribution for a range
+   * of elements. May be executed in parallel on separate threads.
+   */
+  class EstimateError
+  {
+  public:
+    EstimateError (const System & sys,
+                   const PatchUniformRefinementEstimator & ee,
+                   ErrorVector & epc) :
+      system(sys),
+      error_estimator(ee),
+      error_per_cell(epc)
+    {}
+
+    void operator()(const ConstElemRange & range) const;
+
+  private:
+    const System & system;
+    const PatchUniformRefinementEstimator & error_estimator;
+    ErrorVector & error_per_cell;
+  };
+
+  friend class EstimateError;
+
+  /**
+   * The object which assembles the local patch problems.
+   */
+  LocalAssembly * _local_assembly;
+};
+
+} // namespace libMesh
+
+#endif // #ifdef LIBMESH_ENABLE_AMR
+
+#endif // LIBMESH_PATCH_UNIFORM_REFINEMENT_ESTIMATOR_H
@@ -166,6 +166,10 @@ public:
    * computes the sequence \f$ \{ p_n \} \f$, and the iteration is
    * terminated when \f$ \|p - p_n\| < \mbox{\texttt{tolerance}} \f$
    *
+   * Elements with an affine map, as reported by
+   * Elem::has_affine_map(), skip the iteration entirely, and the map
+   * is inverted with a single linear solve.
+   *
    * When secure == true, the following checks are enabled:
    *
    * In DEBUG mode only:
@@ -200,6 +204,12 @@ public:
    * reference element are returned in the vector \p
    * reference_points. The other parameters have the same meaning
    * as the single Point version of inverse_map() above.
+   *
+   * The map of an affine element is only inverted once for all the
+   * points.  Otherwise the Newton iteration for each point starts
+   * from the result for the previous point, if that was on the
+   * reference element, which saves iterations when consecutive
+   * points are close to each other.
    */
   static void inverse_map (unsigned int dim,
                            const Elem * elem,
@@ -1032,6 +1042,19 @@ protected:
   Real jacobian_tolerance;
 
 private:
+  /**
+   * The Newton iteration used by inverse_map() for elements without
+   * an affine map, starting from \p initial_guess on the reference
+   * element.
+   */
+  static Point newton_inverse_map (const unsigned int dim,
+                                   const Elem * elem,
+                                   const Point & physical_point,
+                                   const Point & initial_guess,
+                                   const Real tolerance,
+                                   const bool secure,
+                                   const bool extra_checks);
+
   /**
    * A helper function used by FEMap::compute_single_point_map() to
    * compute second derivatives of the inverse map.
@@ -27,8 +27,10 @@
 #include "libmesh/mesh_output.h"
 #include "libmesh/mesh_communication.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/point.h"
 
 // C++ includes
+#include <map>
 #include <string>
 #include <vector>
 
@@ -37,6 +39,7 @@ namespace libMesh
 // Forward declarations
 class Xdr;
 class CheckpointIO;
+class AsyncFileWriter;
 
 /**
  * split_mesh takes the given initialized/opened mesh and partitions it into nsplits pieces or
@@ -99,6 +102,14 @@ public:
    * running on several processors, input_name should simply be the name of the mesh split
    * directory without the "-split[n]" suffix.  The number of splits will be determined
    * automatically by the number of processes being used for the mesh at the time of reading.
+   *
+   * When a DistributedMesh is read on more processors than the
+   * checkpoint has splits, and the checkpoint includes the index
+   * files written alongside each split of a parallel checkpoint,
+   * each split is read by a contiguous group of processors which
+   * divide its elements among themselves along a space-filling
+   * curve.  Each processor then keeps only the elements it owns plus
+   * their ghosts, so no redistribution is needed after reading.
    */
   virtual void read (const std::string & input_name) override;
 
@@ -193,7 +204,40 @@ public:
   const processor_id_type & current_n_processors() const { return _my_n_processors; }
   processor_id_type & current_n_processors() { return _my_n_processors; }
 
+  /**
+   * Get/Set the writer to use for asynchronous output.
+   *
+   * When a writer is set, write() serializes every file it would
+   * write into memory and then hands them to the writer's I/O
+   * thread, returning as soon as the mesh data has been copied.  The
+   * files are not complete until AsyncFileWriter::wait() has been
+   * called on the writer, which must outlive any pending writes.
+   */
+  AsyncFileWriter * async_writer() const { return _async_writer; }
+  void set_async_writer(AsyncFileWriter * writer) { _async_writer = writer; }
+
 private:
+  /**
+   * \returns An Xdr object for writing \p file_name, either directly
+   * or through the async writer's staging buffers.
+   */
+  std::unique_ptr<Xdr> open_for_writing(const std::string & file_name) const;
+
+  /**
+   * Summary of the elements owned by one split, written alongside it
+   * so that several processors can divide the split on restart
+   * without first reading the whole mesh.
+   */
+  struct SplitIndex
+  {
+    // Bounding box of the split's own elements
+    Point min, max;
+
+    // The space-filling curve keys which start each of a number of
+    // equally sized intervals of the split's active elements
+    std::vector<uint64_t> key_quantiles;
+  };
+
   //---------------------------------------------------------------------------
   // Write Implementation
 
@@ -239,6 +283,13 @@ private:
    */
   void write_bc_names (Xdr & io, const BoundaryInfo & info, bool is_sideset) const;
 
+  /**
+   * Write the SplitIndex for the elements of split \p pid
+   */
+  void write_split_index (Xdr & io,
+                          processor_id_type pid,
+                          const std::set<const Elem *, CompareElemIdsByLevel> & elements) const;
+
 
   //---------------------------------------------------------------------------
   // Read Implementation
@@ -323,6 +374,36 @@ private:
   unsigned int n_active_levels_in(MeshBase::const_element_iterator begin,
                                   MeshBase::const_element_iterator end) const;
 
+  /**
+   * \returns The processor id to assign to an object read with
+   * processor id \p file_pid, located at \p p.  This "wraps around"
+   * processor ids unless we are dividing splits between processors,
+   * in which case the split's index decides which of its readers
+   * gets the object.
+   */
+  processor_id_type map_processor_id (largest_id_type file_pid, const Point & p);
+
+  /**
+   * \returns The index of split \p pid of the checkpoint being
+   * read, reading it first if necessary.
+   */
+  const SplitIndex & split_index (processor_id_type pid);
+
+  /**
+   * Divides the splits of \p input_name, if it has split indices, so
+   * that each of our processors reads one split and owns part of it.
+   * \returns The split this processor should read, or
+   * DofObject::invalid_processor_id if we can't.
+   */
+  processor_id_type setup_split_division (const std::string & input_name,
+                                          processor_id_type input_n_procs);
+
+  /**
+   * After reading divided splits, keep only the elements we own and
+   * ghost, and make parent and node processor ids consistent.
+   */
+  void finish_split_division ();
+
   processor_id_type select_split_config(const std::string & input_name, header_id_type & data_size);
 
   bool _binary;
@@ -334,6 +415,19 @@ private:
 
   // The largest processor id to write
   processor_id_type _my_n_processors;
+
+  // The writer for asynchronous output, if any
+  AsyncFileWriter * _async_writer;
+
+  // The checkpoint whose splits we are dividing among our processors
+  // on read, or empty if we're not dividing splits
+  std::string _divided_name;
+
+  // The number of splits in that checkpoint
+  processor_id_type _divided_n_splits;
+
+  // The indices of the splits we have needed so far
+  std::map<processor_id_type, SplitIndex> _split_indices;
 };
 
 
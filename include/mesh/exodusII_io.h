@@ -92,6 +92,25 @@ public:
    */
   virtual void read (const std::string & name) override;
 
+  /**
+   * Reads the mesh in the file named \p name on every processor at
+   * once, directly into a distributed mesh.  Each processor reads a
+   * contiguous slice of the node arrays and of each element block,
+   * builds only the elements in its slices, and requests the other
+   * nodes of those elements from the processors which read them.
+   * Sidesets, nodesets and elemsets are applied to the local
+   * elements and nodes, and ghost elements are gathered afterward.
+   *
+   * This must be called on every processor.  A ReplicatedMesh, a
+   * file with Bezier extraction data or edge blocks, or a read with
+   * extra integer variables is instead read on processor 0 and
+   * broadcast.
+   *
+   * \note get_elem_num_map() and get_node_num_map() only describe
+   * part of the file after a parallel read.
+   */
+  void read_parallel (const std::string & name);
+
   /**
    * Read only the header information, instead of the entire
    * mesh. After the header is read, the file is closed and the
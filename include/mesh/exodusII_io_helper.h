@@ -168,6 +168,15 @@ public:
    */
   void read_node_num_map();
 
+  /**
+   * Reads the coordinates and the \p node_num_map entries of the \p
+   * n_nodes nodes starting at the zero-based index \p first_node, so
+   * that each processor can read its own share of a large mesh.  The
+   * results are stored in \p x, \p y, \p z and \p node_num_map,
+   * indexed from \p first_node.
+   */
+  void read_partial_nodes(int first_node, int n_nodes);
+
   /**
    * Reads the optional \p bex_cv_blocks from the \p ExodusII mesh
    * file.
@@ -224,6 +233,21 @@ public:
    */
   void read_elem_in_block(int block);
 
+  /**
+   * Reads the element type, number of elements and number of nodes
+   * per element of block \p block, without reading its connectivity.
+   * Bezier extraction blocks are not supported.
+   */
+  void read_block_header(int block);
+
+  /**
+   * Reads the connectivity of the \p n_elem elements starting at the
+   * zero-based index \p first_elem within block \p block into \p
+   * connect.  read_block_header() must have been called for the
+   * same block first.
+   */
+  void read_partial_elem_in_block(int block, int first_elem, int n_elem);
+
   /**
    * Read in edge blocks, storing information in the BoundaryInfo object.
    */
@@ -235,6 +259,13 @@ public:
    */
   void read_elem_num_map();
 
+  /**
+   * Reads the \p elem_num_map entries of the \p n_elem elements
+   * starting at the zero-based index \p first_elem, indexed from \p
+   * first_elem.
+   */
+  void read_partial_elem_num_map(int first_elem, int n_elem);
+
   /**
    * Reads information about all of the sidesets in the \p ExodusII
    * mesh file.
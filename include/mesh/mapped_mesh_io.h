@@ -0,0 +1,103 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MAPPED_MESH_IO_H
+#define LIBMESH_MAPPED_MESH_IO_H
+
+
+// Local includes
+#include "libmesh/mesh_input.h"
+#include "libmesh/mesh_output.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <string>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * The MappedMeshIO class reads and writes meshes in a flat binary
+ * format designed for fast startup.
+ *
+ * The file holds a small header followed by one aligned array per
+ * mesh attribute: node ids, coordinates and processor ids, element
+ * types, connectivity, parent/child and neighbor tables, boundary
+ * conditions and partitioning.  Connectivity, parent and neighbor
+ * entries refer to positions in the file rather than to ids, so
+ * reading needs no id lookups.  On systems with mmap() the file is
+ * mapped rather than read, and the mesh is built directly from the
+ * mapped arrays without any per-object parsing.
+ *
+ * Every processor reads the file.  A ReplicatedMesh, or a
+ * DistributedMesh read on a different number of processors than the
+ * file was partitioned for, gets the whole mesh.  A DistributedMesh
+ * read on the same number of processors as the file was partitioned
+ * for builds only its local elements, their point neighbors and
+ * their ancestors.
+ *
+ * Files are written in native byte order and are not portable
+ * between machines with different endianness.  As with CheckpointIO,
+ * only side and node boundary ids are stored.
+ *
+ * Neighbor links are stored and restored, so users who do not modify
+ * the mesh before preparing it may set allow_find_neighbors(false)
+ * to skip the neighbor search in prepare_for_use().
+ *
+ * \date 2026
+ * \brief Reads and writes memory-mappable binary mesh files.
+ */
+class MappedMeshIO : public MeshInput<MeshBase>,
+                     public MeshOutput<MeshBase>,
+                     public ParallelObject
+{
+public:
+  /**
+   * Constructor.  Takes a writable reference to a mesh object.
+   * This is the constructor required to read a mesh.
+   */
+  explicit
+  MappedMeshIO (MeshBase &);
+
+  /**
+   * Constructor.  Takes a reference to a constant mesh object.
+   * This constructor will only allow us to write the mesh.
+   */
+  explicit
+  MappedMeshIO (const MeshBase &);
+
+  /**
+   * This method implements reading a mesh from a specified file.
+   */
+  virtual void read (const std::string & name) override;
+
+  /**
+   * This method implements writing a mesh to a specified file.  A
+   * distributed mesh is serialized to processor 0 for writing.
+   */
+  virtual void write (const std::string & name) override;
+};
+
+
+} // namespace libMesh
+
+#endif // LIBMESH_MAPPED_MESH_IO_H
@@ -65,6 +65,11 @@ class QueryElemSubdomainIDBase;
  *
  * Boundary ids are set to be equal to the side indexing on a
  * master hex
+ *
+ * A DistributedMesh of EDGE2, QUAD4 or HEX8 elements with the default
+ * ghosting is built in parallel, with each processor creating only
+ * its own box of elements and the layer around it, already
+ * partitioned and with its neighbors found.
  */
 void build_cube (UnstructuredMesh & mesh,
                  const unsigned int nx=0,
@@ -67,7 +67,9 @@ public:
   /**
    * The actual smoothing function, gets called whenever
    * the user specifies an actual number of smoothing
-   * iterations.
+   * iterations.  Each iteration is a Jacobi sweep, which moves the
+   * local nodes in parallel across threads and then updates the
+   * ghost nodes from their owners.
    */
   void smooth(unsigned int n_iterations);
 
@@ -88,10 +90,10 @@ public:
 
 private:
   /**
-   * This function allgather's the (local) graph after
+   * This function allgather's the (local) \p graph after
    * it is computed on each processor by the init() function.
    */
-  void allgather_graph();
+  void allgather_graph(std::vector<std::vector<dof_id_type>> & graph);
 
   /**
    * True if the L-graph has been created, false otherwise.
@@ -99,9 +101,14 @@ private:
   bool _initialized;
 
   /**
-   * Data structure for holding the L-graph
+   * The L-graph, in compressed sparse row form: the nodes connected
+   * to node \p i are _graph_neighbors[_graph_offsets[i]] through
+   * _graph_neighbors[_graph_offsets[i+1]-1].  This keeps each sweep
+   * reading contiguous memory, which matters when the smoother is
+   * called over and over, e.g. for mesh morphing.
    */
-  std::vector<std::vector<dof_id_type>> _graph;
+  std::vector<dof_id_type> _graph_offsets;
+  std::vector<dof_id_type> _graph_neighbors;
 };
 
 
@@ -57,6 +57,19 @@ class UnstructuredMesh;
  * 3) L. Branets, "A variational grid optimization algorithm based on a local
  * cell quality metric", Ph.D. thesis, The University of Texas at Austin, 2005.
  *
+ * The functional is minimized over all the nodes at once, so a
+ * distributed mesh is gathered onto processor 0 for smoothing, and
+ * the new node positions are then sent back to every processor.  A
+ * DistributedMesh is therefore accepted but not really supported:
+ * processor 0 holds the whole mesh, and all of the smoother's work
+ * arrays, while it is smoothed, and the other processors sit idle.
+ * Smoothing each processor's own cells, and exchanging the positions
+ * of ghost nodes between iterations, has not been implemented.
+ *
+ * Only the cell loops which evaluate the functional and the local
+ * gradients and Hessians are threaded.  The assembly of the Newton
+ * system and its PCG solve are serial.
+ *
  * \author Derek R. Gaston
  * \date 2006
  */
@@ -258,14 +271,26 @@ private:
   };
 
 
-  int writegr(const Array2D<Real> & R);
+  /**
+   * Moves the nodes with ids \p node_ids which this processor has to
+   * \p positions, which holds _dim coordinates per node.
+   */
+  int writegr(const std::vector<dof_id_type> & node_ids,
+              const std::vector<Real> & positions);
 
+  /**
+   * Fills in the arrays describing the mesh.  The rows of \p R are
+   * the nodes in the order of \p node_ids, and everything else
+   * refers to nodes by their row, so that the node ids need not be
+   * contiguous.
+   */
   int readgr(Array2D<Real> & R,
              std::vector<int> & mask,
              Array2D<int> & cells,
              std::vector<int> & mcells,
              std::vector<int> & edges,
-             std::vector<int> & hnodes);
+             std::vector<int> & hnodes,
+             std::vector<dof_id_type> & node_ids);
 
   int readmetr(std::string name,
                Array3D<Real> & H);
@@ -357,6 +382,53 @@ private:
                const std::vector<Real> & afun,
                int NCN);
 
+  /**
+   * Computes the local Hessians \p W, gradients \p F and functional
+   * values \p J of the cells [\p begin, \p end), in parallel across
+   * threads, along with their adaptation metrics \p G.  Entry i of
+   * \p W, \p F and \p J belongs to cell \p begin + i.
+   */
+  void local_systems(dof_id_type begin,
+                     dof_id_type end,
+                     Array2D<Real> & R,
+                     const std::vector<int> & mask,
+                     const Array2D<int> & cells,
+                     const std::vector<int> & mcells,
+                     Real epsilon,
+                     Real w,
+                     int me,
+                     const Array3D<Real> & H,
+                     Real vol,
+                     int adp,
+                     const std::vector<Real> & afun,
+                     Array2D<Real> & G,
+                     std::vector<Array3D<Real>> & W,
+                     std::vector<Array2D<Real>> & F,
+                     std::vector<Real> & J);
+
+  /**
+   * \returns The value of the functional at the node positions \p R,
+   * summed over the cells that are not excluded, and sets \p Vmin,
+   * \p emax and \p qmin to their extremes over those cells.  The
+   * cells are evaluated in parallel across threads, but combined in
+   * order, so the result doesn't depend on the number of threads.
+   */
+  Real functional(Array2D<Real> & R,
+                  const std::vector<int> & mask,
+                  const Array2D<int> & cells,
+                  const std::vector<int> & mcells,
+                  Real epsilon,
+                  Real w,
+                  int me,
+                  const Array3D<Real> & H,
+                  Real vol,
+                  int adp,
+                  const std::vector<Real> & afun,
+                  Array2D<Real> & G,
+                  Real & Vmin,
+                  Real & emax,
+                  Real & qmin);
+
   Real localP(Array3D<Real> & W,
               Array2D<Real> & F,
               Array2D<Real> & R,
@@ -100,6 +100,34 @@ public:
                                                      double quality_constraint=0.,
                                                      double volume_constraint=0.);
 
+  /**
+   * Method invokes TetGen library to compute the same kind of
+   * tetrahedralization as triangulate_conformingDelaunayMesh_carvehole(),
+   * but without ever holding the whole volume mesh on one processor.
+   *
+   * The hull, which is first gathered onto every processor of a
+   * DistributedMesh, is tetrahedralized coarsely, with the quality
+   * constraint but a volume constraint \p coarsening times larger.
+   * The coarse tetrahedra are split into \p n_subregions spatially
+   * compact subregions (by default one per processor), whose
+   * boundaries are triangulated finely enough for the volume
+   * constraint on every processor alike.  Those triangulations then
+   * stay fixed while each processor refines its own subregions, and
+   * carves out any \p holes they enclose, with TetGen, so the pieces
+   * conform where they meet.
+   * On a DistributedMesh each processor keeps only the elements it
+   * built, plus ghosts from its neighbors; a ReplicatedMesh gathers
+   * the pieces from every processor.
+   *
+   * As with the other methods, the Mesh should be prepared for use
+   * afterwards.
+   */
+  void triangulate_conformingDelaunayMesh_distributed (const std::vector<Point> & holes,
+                                                       double quality_constraint=0.,
+                                                       double volume_constraint=0.,
+                                                       unsigned int n_subregions=0,
+                                                       double coarsening=512.);
+
 
 
 protected:
@@ -127,7 +127,8 @@ NameBasedIO::is_parallel_file_format (std::string_view name)
           (name.rfind(".xdr") < name.size()) ||
           (name.rfind(".nem") == name.size() - 4) ||
           (name.rfind(".n") == name.size() - 2) ||
-          (name.rfind(".cp") < name.size())
+          (name.rfind(".cp") < name.size()) ||
+          (name.rfind(".lmm") < name.size())
           );
 }
 
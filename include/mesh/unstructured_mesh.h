@@ -25,6 +25,8 @@
 
 // C++ Includes
 #include <cstddef>
+#include <set>
+#include <vector>
 
 namespace libMesh
 {
@@ -202,6 +204,36 @@ public:
                       bool use_binary_search=true,
                       bool enforce_all_nodes_match_on_boundaries=false);
 
+  /**
+   * Stitch all of \p other_meshes to this mesh at once, so that this
+   * mesh becomes the union of all of them.  Nodes of any of the meshes
+   * which lie on any of the boundaries in \p boundary_ids (sidesets,
+   * edgesets or nodesets) are merged when they are closer together
+   * than \p tol times the smallest edge length on those boundaries.
+   * Merged nodes take the id of the node from the first mesh, with
+   * this mesh coming before \p other_meshes.
+   *
+   * Rather than stitching the meshes pairwise, the boundary nodes
+   * are hashed onto a grid with the merging distance as its spacing,
+   * the matching nodes are found on all processors and threads, and
+   * the meshes are all copied in and prepared for use once.  This
+   * makes assembling a model from many component meshes much faster
+   * than repeated calls to the two-mesh stitch_meshes().
+   *
+   * If \p clear_stitched_boundary_ids==true, boundary ids in \p
+   * boundary_ids are cleared from sides which are now internal to the
+   * mesh.
+   *
+   * Element, node and unique ids from this mesh are unchanged, and
+   * those from each of \p other_meshes are incremented by the sum of
+   * the corresponding max ids of this mesh and the meshes before it.
+   */
+  void stitch_meshes (const std::vector<const MeshBase *> & other_meshes,
+                      const std::set<boundary_id_type> & boundary_ids,
+                      Real tol=TOLERANCE,
+                      bool clear_stitched_boundary_ids=false,
+                      bool verbose=true);
+
   /**
    * Similar to stitch_meshes, except that we stitch two adjacent surfaces within this mesh.
    */
@@ -252,6 +284,27 @@ public:
 
 private:
 
+  /**
+   * Adds copies of the nodes and elements of \p other_mesh, as
+   * copy_nodes_and_elements() does, but without preparing the mesh
+   * for use afterwards, so that several meshes can be added before
+   * it is prepared once.
+   */
+  void add_nodes_and_elements (const MeshBase & other_mesh,
+                               const bool skip_find_neighbors,
+                               dof_id_type element_id_offset,
+                               dof_id_type node_id_offset,
+                               unique_id_type unique_id_offset);
+
+  /**
+   * Copies the boundary ids, boundary names and elemsets of \p
+   * other_mesh, whose nodes and elements have been copied into this
+   * mesh with ids offset by \p node_delta and \p elem_delta.
+   */
+  void merge_boundary_data (const MeshBase & other_mesh,
+                            dof_id_type elem_delta,
+                            dof_id_type node_delta);
+
   /**
    * Helper function for stitch_meshes and stitch_surfaces
    * that does the mesh stitching.
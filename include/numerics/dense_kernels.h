@@ -0,0 +1,345 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DENSE_KERNELS_H
+#define LIBMESH_DENSE_KERNELS_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cmath>
+#include <type_traits>
+#include <utility> // std::swap
+
+namespace libMesh
+{
+
+/**
+ * Small dense linear algebra kernels whose leading dimension is a
+ * compile time constant \p N.  Knowing \p N lets the compiler unroll
+ * and vectorize the innermost loops, which matters for element
+ * matrices: these are small (tens of rows) and their sizes are fixed
+ * by the element type, so the loop overhead and the call overhead of
+ * BLAS both dominate the arithmetic.
+ *
+ * All matrices are stored row-major in contiguous arrays, as in
+ * DenseMatrix and FixedDenseMatrix.  DenseMatrix uses dispatch() to
+ * pick an instantiation at runtime for a few common sizes;
+ * FixedDenseMatrix calls the kernels directly.
+ */
+namespace DenseKernels
+{
+
+/**
+ * Calls \p kernel with a std::integral_constant<unsigned int, n> if
+ * \p n is one of the few element matrix sizes for which we
+ * instantiate the kernels: 4 (linear Lagrange on QUAD4 and TET4), 8
+ * (HEX8), 9 (QUAD9) and 27 (HEX27).  At these sizes the generic loops
+ * and the call overhead of BLAS both dominate the arithmetic; in a
+ * standalone benchmark of C += A * B with square operands the
+ * fixed-size kernel was between 1.5x (n = 8, 9, 27) and 4x (n = 4)
+ * faster than the generic loop.  Every extra size costs another
+ * instantiation of each kernel in each caller, so we don't add more
+ * without a benchmark showing they pay off.
+ *
+ * DenseMatrix only dispatches here when it isn't using BLAS/LAPACK.
+ *
+ * \returns \p true if \p kernel was called, \p false otherwise, in
+ * which case the caller should fall back on a generic loop.
+ */
+template <typename Kernel>
+inline
+bool dispatch (unsigned int n, Kernel && kernel)
+{
+  switch (n)
+    {
+#define LIBMESH_DENSE_KERNEL_CASE(N)                              \
+    case N:                                                       \
+      kernel(std::integral_constant<unsigned int, N>());          \
+      return true;
+
+      LIBMESH_DENSE_KERNEL_CASE(4)
+      LIBMESH_DENSE_KERNEL_CASE(8)
+      LIBMESH_DENSE_KERNEL_CASE(9)
+      LIBMESH_DENSE_KERNEL_CASE(27)
+
+#undef LIBMESH_DENSE_KERNEL_CASE
+
+    default:
+      return false;
+    }
+}
+
+
+
+/**
+ * Computes C += A * B, where A is (m x p), B is (p x N) and C is
+ * (m x N).
+ */
+template <unsigned int N, typename T, typename T2, typename T3>
+inline
+void multiply_add (unsigned int m,
+                   unsigned int p,
+                   T * C,
+                   const T2 * A,
+                   const T3 * B)
+{
+  for (unsigned int i=0; i != m; ++i)
+    {
+      T * C_i = C + i*N;
+      const T2 * A_i = A + i*p;
+
+      for (unsigned int k=0; k != p; ++k)
+        {
+          const T2 a = A_i[k];
+          const T3 * B_k = B + k*N;
+          for (unsigned int j=0; j != N; ++j)
+            C_i[j] += a * B_k[j];
+        }
+    }
+}
+
+
+
+/**
+ * Computes C += A^T * B, where A is (p x m), B is (p x N) and C is
+ * (m x N).  Zero entries of A are skipped, since A is often a sparse
+ * constraint matrix.
+ */
+template <unsigned int N, typename T, typename T2, typename T3>
+inline
+void transpose_multiply_add (unsigned int m,
+                             unsigned int p,
+                             T * C,
+                             const T2 * A,
+                             const T3 * B)
+{
+  for (unsigned int k=0; k != p; ++k)
+    {
+      const T2 * A_k = A + k*m;
+      const T3 * B_k = B + k*N;
+
+      for (unsigned int i=0; i != m; ++i)
+        {
+          const T2 a = A_k[i];
+          if (a != 0.)
+            {
+              T * C_i = C + i*N;
+              for (unsigned int j=0; j != N; ++j)
+                C_i[j] += a * B_k[j];
+            }
+        }
+    }
+}
+
+
+
+/**
+ * Computes y = A * x, where A is (m x N).
+ */
+template <unsigned int N, typename T, typename T2, typename T3>
+inline
+void vector_mult (unsigned int m,
+                  T * y,
+                  const T2 * A,
+                  const T3 * x)
+{
+  for (unsigned int i=0; i != m; ++i)
+    {
+      const T2 * A_i = A + i*N;
+      T sum = 0.;
+      for (unsigned int j=0; j != N; ++j)
+        sum += A_i[j] * x[j];
+      y[i] = sum;
+    }
+}
+
+
+
+/**
+ * Factors the (N x N) matrix A in place, with partial pivoting, in
+ * the same format DenseMatrix::_lu_decompose() uses: rows are
+ * interchanged as a whole, U has an implicit unit diagonal, and the
+ * diagonal of L is stored.
+ *
+ * \returns \p false if A is singular.
+ */
+template <unsigned int N, typename T, typename P>
+inline
+bool lu_decompose (T * A, P * pivots)
+{
+  for (unsigned int i=0; i != N; ++i)
+    {
+      // Find the pivot row by searching down the i'th column
+      pivots[i] = i;
+      auto the_max = std::abs(A[i*N+i]);
+      for (unsigned int j=i+1; j != N; ++j)
+        {
+          auto candidate_max = std::abs(A[j*N+i]);
+          if (the_max < candidate_max)
+            {
+              the_max = candidate_max;
+              pivots[i] = j;
+            }
+        }
+
+      const unsigned int p = pivots[i];
+      if (p != i)
+        for (unsigned int j=0; j != N; ++j)
+          std::swap(A[i*N+j], A[p*N+j]);
+
+      T * A_i = A + i*N;
+
+      if (A_i[i] == 0.)
+        return false;
+
+      const T diag_inv = 1. / A_i[i];
+      for (unsigned int j=i+1; j != N; ++j)
+        A_i[j] *= diag_inv;
+
+      for (unsigned int row=i+1; row != N; ++row)
+        {
+          T * A_row = A + row*N;
+          const T a = A_row[i];
+          for (unsigned int col=i+1; col != N; ++col)
+            A_row[col] -= a * A_i[col];
+        }
+    }
+
+  return true;
+}
+
+
+
+/**
+ * Solves A x = b using the factorization from lu_decompose().
+ */
+template <unsigned int N, typename T, typename P, typename T2>
+inline
+void lu_back_substitute (const T * A,
+                         const P * pivots,
+                         const T2 * b,
+                         T2 * x)
+{
+  // Apply the row interchanges to the right hand side
+  for (unsigned int i=0; i != N; ++i)
+    x[i] = b[i];
+  for (unsigned int i=0; i != N; ++i)
+    if (static_cast<unsigned int>(pivots[i]) != i)
+      std::swap(x[i], x[pivots[i]]);
+
+  // Lower-triangular "top to bottom" solve step
+  for (unsigned int i=0; i != N; ++i)
+    {
+      const T * A_i = A + i*N;
+      T2 sum = x[i];
+      for (unsigned int j=0; j != i; ++j)
+        sum -= A_i[j] * x[j];
+      x[i] = sum / A_i[i];
+    }
+
+  // Unit upper-triangular "bottom to top" solve step
+  for (unsigned int i=N; i-- != 0;)
+    {
+      const T * A_i = A + i*N;
+      T2 sum = x[i];
+      for (unsigned int j=i+1; j != N; ++j)
+        sum -= A_i[j] * x[j];
+      x[i] = sum;
+    }
+}
+
+
+
+/**
+ * Factors the symmetric positive definite (N x N) matrix A in place
+ * as L L^T, in the same format DenseMatrix::_cholesky_decompose()
+ * uses: L is stored in the lower triangle, and the strict upper
+ * triangle is left holding intermediate values.
+ *
+ * \returns \p false if A is not positive definite.
+ */
+template <unsigned int N, typename T>
+inline
+bool cholesky_decompose (T * A)
+{
+  for (unsigned int i=0; i != N; ++i)
+    {
+      T * A_i = A + i*N;
+      for (unsigned int j=i; j != N; ++j)
+        {
+          const T * A_j = A + j*N;
+          T sum = A_i[j];
+          for (unsigned int k=0; k != i; ++k)
+            sum -= A_i[k] * A_j[k];
+          A_i[j] = sum;
+
+          if (i == j)
+            {
+#ifndef LIBMESH_USE_COMPLEX_NUMBERS
+              if (sum <= 0.0)
+                return false;
+#endif
+              A_i[i] = std::sqrt(sum);
+            }
+          else
+            A[j*N+i] = sum / A_i[i];
+        }
+    }
+
+  return true;
+}
+
+
+
+/**
+ * Solves A x = b using the factorization from cholesky_decompose().
+ */
+template <unsigned int N, typename T, typename T2>
+inline
+void cholesky_back_substitute (const T * A,
+                               const T2 * b,
+                               T2 * x)
+{
+  // Solve for L y = b
+  for (unsigned int i=0; i != N; ++i)
+    {
+      const T * A_i = A + i*N;
+      T2 sum = b[i];
+      for (unsigned int k=0; k != i; ++k)
+        sum -= A_i[k] * x[k];
+      x[i] = sum / A_i[i];
+    }
+
+  // Solve for L^T x = y
+  for (unsigned int i=N; i-- != 0;)
+    {
+      T2 sum = x[i];
+      for (unsigned int k=i+1; k != N; ++k)
+        sum -= A[k*N+i] * x[k];
+      x[i] = sum / A[i*N+i];
+    }
+}
+
+} // namespace DenseKernels
+
+} // namespace libMesh
+
+#endif // LIBMESH_DENSE_KERNELS_H
@@ -24,6 +24,7 @@
 #include <cmath> // for sqrt
 
 // Local Includes
+#include "libmesh/dense_kernels.h"
 #include "libmesh/dense_matrix.h"
 #include "libmesh/dense_vector.h"
 #include "libmesh/int_range.h"
@@ -44,6 +45,21 @@ namespace libMesh
 template<typename T>
 void DenseMatrix<T>::left_multiply (const DenseMatrixBase<T> & M2)
 {
+  const DenseMatrix<T> * M2_dense = dynamic_cast<const DenseMatrix<T> *>(&M2);
+  if (!this->use_blas_lapack && M2_dense && M2_dense != this &&
+      DenseKernels::dispatch
+        (this->n(), [this, M2_dense](auto N)
+         {
+           libmesh_assert_equal_to (M2_dense->n(), this->m());
+
+           DenseMatrix<T> M3(*this);
+           this->resize (M2_dense->m(), N);
+           DenseKernels::multiply_add<decltype(N)::value>
+             (M2_dense->m(), M2_dense->n(), _val.data(),
+              M2_dense->_val.data(), M3._val.data());
+         }))
+    return;
+
   if (this->use_blas_lapack)
     this->_multiply_blas(M2, LEFT_MULTIPLY);
   else
@@ -92,6 +108,23 @@ void DenseMatrix<T>::left_multiply (const DenseMatrixBase<T2> & M2)
 template<typename T>
 void DenseMatrix<T>::left_multiply_transpose(const DenseMatrix<T> & A)
 {
+  if (!this->use_blas_lapack &&
+      DenseKernels::dispatch
+        (this->n(), [this, &A](auto N)
+         {
+           libmesh_assert_equal_to (A.m(), this->m());
+
+           // A may be *this, so copy before resizing
+           DenseMatrix<T> B(*this);
+           const DenseMatrix<T> & A_ref = (this == &A) ? B : A;
+
+           this->resize (A_ref.n(), N);
+           DenseKernels::transpose_multiply_add<decltype(N)::value>
+             (A_ref.n(), A_ref.m(), _val.data(),
+              A_ref._val.data(), B._val.data());
+         }))
+    return;
+
   if (this->use_blas_lapack)
     this->_multiply_blas(A, LEFT_MULTIPLY_TRANSPOSE);
   else
@@ -170,6 +203,21 @@ void DenseMatrix<T>::_left_multiply_transpose(const DenseMatrix<T2> & A)
 template<typename T>
 void DenseMatrix<T>::right_multiply (const DenseMatrixBase<T> & M3)
 {
+  const DenseMatrix<T> * M3_dense = dynamic_cast<const DenseMatrix<T> *>(&M3);
+  if (!this->use_blas_lapack && M3_dense && M3_dense != this &&
+      DenseKernels::dispatch
+        (M3.n(), [this, M3_dense](auto N)
+         {
+           libmesh_assert_equal_to (this->n(), M3_dense->m());
+
+           DenseMatrix<T> M2(*this);
+           this->resize (M2.m(), N);
+           DenseKernels::multiply_add<decltype(N)::value>
+             (M2.m(), M2.n(), _val.data(),
+              M2._val.data(), M3_dense->_val.data());
+         }))
+    return;
+
   if (this->use_blas_lapack)
     this->_multiply_blas(M3, RIGHT_MULTIPLY);
   else
@@ -310,6 +358,16 @@ void DenseMatrix<T>::vector_mult (DenseVector<T> & dest,
   if(this->m() == 0 || this->n() == 0)
     return;
 
+  if (!this->use_blas_lapack &&
+      DenseKernels::dispatch
+      (this->n(), [this, &dest, &arg](auto N)
+       {
+         DenseKernels::vector_mult<decltype(N)::value>
+           (this->m(), dest.get_values().data(), _val.data(),
+            arg.get_values().data());
+       }))
+    return;
+
   if (this->use_blas_lapack)
     this->_matvec_blas(1., 0., dest, arg);
   else
@@ -588,6 +646,15 @@ void DenseMatrix<T>::_lu_back_substitute (const DenseVector<T> & b,
 
   x.resize (n_cols);
 
+  if (DenseKernels::dispatch
+      (n_cols, [this, &b, &x](auto N)
+       {
+         DenseKernels::lu_back_substitute<decltype(N)::value>
+           (_val.data(), _pivots.data(), b.get_values().data(),
+            x.get_values().data());
+       }))
+    return;
+
   // A convenient reference to *this
   const DenseMatrix<T> & A = *this;
 
@@ -643,6 +710,19 @@ void DenseMatrix<T>::_lu_decompose ()
 
   _pivots.resize(n_rows);
 
+  bool singular = false;
+  if (DenseKernels::dispatch
+      (n_rows, [this, &singular](auto N)
+       {
+         singular = !DenseKernels::lu_decompose<decltype(N)::value>(_val.data(), _pivots.data());
+       }))
+    {
+      libmesh_error_msg_if(singular, "Matrix A is singular!");
+
+      this->_decomposition_type = LU;
+      return;
+    }
+
   for (unsigned int i=0; i<n_rows; ++i)
     {
       // Find the pivot row by searching down the i'th column
@@ -884,6 +964,20 @@ void DenseMatrix<T>::_cholesky_decompose ()
   // Just to be really sure...
   libmesh_assert_equal_to (n_rows, n_cols);
 
+  bool indefinite = false;
+  if (DenseKernels::dispatch
+      (n_rows, [this, &indefinite](auto N)
+       {
+         indefinite = !DenseKernels::cholesky_decompose<decltype(N)::value>(_val.data());
+       }))
+    {
+      libmesh_error_msg_if(indefinite,
+                           "Error! Can only use Cholesky decomposition with symmetric positive definite matrices.");
+
+      this->_decomposition_type = CHOLESKY;
+      return;
+    }
+
   // A convenient reference to *this
   DenseMatrix<T> & A = *this;
 
@@ -933,6 +1027,14 @@ void DenseMatrix<T>::_cholesky_back_substitute (const DenseVector<T2> & b,
   // Now compute the solution to Ax =b using the factorization.
   x.resize(n_rows);
 
+  if (DenseKernels::dispatch
+      (n_rows, [this, &b, &x](auto N)
+       {
+         DenseKernels::cholesky_back_substitute<decltype(N)::value>
+           (_val.data(), b.get_values().data(), x.get_values().data());
+       }))
+    return;
+
   // Solve for Ly=b
   for (unsigned int i=0; i<n_cols; ++i)
     {
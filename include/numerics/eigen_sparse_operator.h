@@ -0,0 +1,267 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_EIGEN_SPARSE_OPERATOR_H
+#define LIBMESH_EIGEN_SPARSE_OPERATOR_H
+
+#include "libmesh/libmesh_common.h"
+
+#ifdef LIBMESH_HAVE_EIGEN
+
+// Local includes
+#include "libmesh/eigen_core_support.h"
+#include "libmesh/vector_kernels.h"
+
+namespace libMesh
+{
+class EigenSparseOperator;
+}
+
+namespace Eigen
+{
+namespace internal
+{
+// EigenSparseOperator has the traits of the matrix it wraps
+template <>
+struct traits<libMesh::EigenSparseOperator> :
+    public traits<libMesh::EigenSM>
+{};
+} // namespace internal
+} // namespace Eigen
+
+namespace libMesh
+{
+
+/**
+ * Computes y += alpha * A * x for the row-major sparse matrix \p A,
+ * with the rows split between the libMesh threads.  \p A may be in
+ * compressed or uncompressed mode.  \p x must not alias \p y.
+ *
+ * Eigen only threads its sparse matrix-vector products when it is
+ * built with OpenMP, which libMesh does not assume.
+ */
+inline
+void eigen_sparse_multiply_add (const EigenSM & A,
+                                const Number * x,
+                                Number * y,
+                                const Number alpha = 1.)
+{
+  const eigen_idx_type * outer = A.outerIndexPtr();
+  const eigen_idx_type * inner = A.innerIndexPtr();
+  const eigen_idx_type * inner_nnz = A.innerNonZeroPtr();
+  const Number * values = A.valuePtr();
+
+  VectorKernels::for_each_chunk
+    (A.rows(),
+     [outer, inner, inner_nnz, values, x, y, alpha]
+     (std::size_t begin, std::size_t end)
+     {
+       for (std::size_t i = begin; i != end; ++i)
+         {
+           const eigen_idx_type row_begin = outer[i];
+           const eigen_idx_type row_end =
+             inner_nnz ? row_begin + inner_nnz[i] : outer[i+1];
+
+           Number sum = 0.;
+           for (eigen_idx_type k = row_begin; k != row_end; ++k)
+             sum += values[k] * x[inner[k]];
+
+           y[i] += alpha * sum;
+         }
+     });
+}
+
+
+
+/**
+ * Wraps an EigenSM so that Eigen's iterative solvers use
+ * eigen_sparse_multiply_add() for their matrix-vector products,
+ * following the "matrix-free solver" pattern from the Eigen
+ * documentation.
+ *
+ * \date 2023
+ */
+class EigenSparseOperator : public Eigen::EigenBase<EigenSparseOperator>
+{
+public:
+  typedef Number Scalar;
+  typedef Real RealScalar;
+  typedef eigen_idx_type StorageIndex;
+  enum
+    {
+      ColsAtCompileTime = Eigen::Dynamic,
+      MaxColsAtCompileTime = Eigen::Dynamic,
+      IsRowMajor = true
+    };
+
+  explicit
+  EigenSparseOperator (const EigenSM & mat) : _mat(mat) {}
+
+  Eigen::Index rows() const { return _mat.rows(); }
+  Eigen::Index cols() const { return _mat.cols(); }
+
+  /**
+   * \returns The wrapped matrix.
+   */
+  const EigenSM & matrix() const { return _mat; }
+
+  template <typename Rhs>
+  Eigen::Product<EigenSparseOperator, Rhs, Eigen::AliasFreeProduct>
+  operator* (const Eigen::MatrixBase<Rhs> & x) const
+  {
+    return Eigen::Product<EigenSparseOperator, Rhs, Eigen::AliasFreeProduct>(*this, x.derived());
+  }
+
+private:
+  const EigenSM & _mat;
+};
+
+
+
+/**
+ * A Jacobi preconditioner for Eigen's iterative solvers, equivalent
+ * to Eigen::DiagonalPreconditioner but applied in parallel on the
+ * libMesh threads.
+ *
+ * \date 2023
+ */
+class EigenJacobiPreconditioner
+{
+public:
+  typedef Number Scalar;
+  typedef eigen_idx_type StorageIndex;
+  enum
+    {
+      ColsAtCompileTime = Eigen::Dynamic,
+      MaxColsAtCompileTime = Eigen::Dynamic
+    };
+
+  EigenJacobiPreconditioner () : _is_initialized(false) {}
+
+  Eigen::Index rows() const { return _inv_diag.size(); }
+  Eigen::Index cols() const { return _inv_diag.size(); }
+
+  EigenJacobiPreconditioner & analyzePattern (const EigenSparseOperator &)
+  { return *this; }
+
+  /**
+   * Inverts the diagonal of the matrix.  Zero or missing diagonal
+   * entries are replaced by one, as in Eigen::DiagonalPreconditioner.
+   */
+  EigenJacobiPreconditioner & factorize (const EigenSparseOperator & op)
+  {
+    const EigenSM & A = op.matrix();
+    _inv_diag.resize(A.rows());
+
+    Number * inv_diag = _inv_diag.data();
+    VectorKernels::for_each_chunk
+      (A.rows(),
+       [&A, inv_diag](std::size_t begin, std::size_t end)
+       {
+         for (std::size_t i = begin; i != end; ++i)
+           {
+             const Number d = A.coeff(i, i);
+             inv_diag[i] = (d != Number(0)) ? Number(1) / d : Number(1);
+           }
+       });
+
+    _is_initialized = true;
+    return *this;
+  }
+
+  EigenJacobiPreconditioner & compute (const EigenSparseOperator & op)
+  { return this->factorize(op); }
+
+  template <typename Rhs>
+  const Eigen::Solve<EigenJacobiPreconditioner, Rhs>
+  solve (const Eigen::MatrixBase<Rhs> & b) const
+  {
+    libmesh_assert(_is_initialized);
+    libmesh_assert_equal_to(_inv_diag.size(), b.rows());
+    return Eigen::Solve<EigenJacobiPreconditioner, Rhs>(*this, b.derived());
+  }
+
+  /**
+   * Computes x = D^{-1} b; called by Eigen when a Solve expression
+   * is evaluated.
+   */
+  template <typename Rhs, typename Dest>
+  void _solve_impl (const Rhs & b, Dest & x) const
+  {
+    const Eigen::Ref<const EigenSV> b_ref(b);
+    x.resize(b_ref.size());
+    Eigen::Ref<EigenSV> x_ref(x);
+
+    const Number * inv_diag = _inv_diag.data();
+    const Number * b_data = b_ref.data();
+    Number * x_data = x_ref.data();
+    VectorKernels::for_each_chunk
+      (b_ref.size(),
+       [inv_diag, b_data, x_data](std::size_t begin, std::size_t end)
+       {
+         for (std::size_t i = begin; i != end; ++i)
+           x_data[i] = inv_diag[i] * b_data[i];
+       });
+  }
+
+  Eigen::ComputationInfo info() const { return Eigen::Success; }
+
+private:
+  EigenSV _inv_diag;
+  bool _is_initialized;
+};
+
+} // namespace libMesh
+
+
+
+namespace Eigen
+{
+namespace internal
+{
+
+/**
+ * Evaluates EigenSparseOperator * vector products with
+ * libMesh::eigen_sparse_multiply_add().
+ */
+template <typename Rhs>
+struct generic_product_impl<libMesh::EigenSparseOperator, Rhs, SparseShape, DenseShape, GemvProduct> :
+    generic_product_impl_base<libMesh::EigenSparseOperator, Rhs,
+                              generic_product_impl<libMesh::EigenSparseOperator, Rhs>>
+{
+  typedef typename Product<libMesh::EigenSparseOperator, Rhs>::Scalar Scalar;
+
+  template <typename Dest>
+  static void scaleAndAddTo (Dest & dst,
+                             const libMesh::EigenSparseOperator & lhs,
+                             const Rhs & rhs,
+                             const Scalar & alpha)
+  {
+    const Ref<const libMesh::EigenSV> x(rhs);
+    Ref<libMesh::EigenSV> y(dst);
+    libMesh::eigen_sparse_multiply_add(lhs.matrix(), x.data(), y.data(), alpha);
+  }
+};
+
+} // namespace internal
+} // namespace Eigen
+
+#endif // LIBMESH_HAVE_EIGEN
+
+#endif // LIBMESH_EIGEN_SPARSE_OPERATOR_H
@@ -0,0 +1,245 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FIXED_DENSE_MATRIX_H
+#define LIBMESH_FIXED_DENSE_MATRIX_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_kernels.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/fixed_dense_vector.h"
+
+// C++ includes
+#include <array>
+
+namespace libMesh
+{
+
+/**
+ * An (M x N) dense matrix whose dimensions are known at compile
+ * time, for element-level algebra where the number of dofs is fixed
+ * by the element type.  Storage is a row-major \p std::array, so
+ * these matrices never allocate, and every operation runs one of the
+ * \p DenseKernels with its loop bounds fixed at compile time.
+ *
+ * As with \p DenseMatrix, lu_solve() and cholesky_solve() factor the
+ * matrix in place and reuse the factorization on later calls.
+ *
+ * \date 2023
+ */
+template <typename T, unsigned int M, unsigned int N>
+class FixedDenseMatrix
+{
+public:
+
+  /**
+   * Constructor.  Creates a zero matrix.
+   */
+  FixedDenseMatrix() :
+    _decomposition_type(NONE)
+  { _val.fill(T(0)); }
+
+  /**
+   * Copy-constructor, from an (M x N) \p DenseMatrix.
+   */
+  explicit
+  FixedDenseMatrix(const DenseMatrix<T> & other) :
+    _decomposition_type(NONE)
+  {
+    libmesh_assert_equal_to (other.m(), M);
+    libmesh_assert_equal_to (other.n(), N);
+    const std::vector<T> & other_vals = other.get_values();
+    for (unsigned int i=0; i != M*N; ++i)
+      _val[i] = other_vals[i];
+  }
+
+  static constexpr unsigned int m() { return M; }
+  static constexpr unsigned int n() { return N; }
+
+  /**
+   * Sets all entries of the matrix to 0 and forgets any
+   * factorization.
+   */
+  void zero()
+  {
+    _decomposition_type = NONE;
+    _val.fill(T(0));
+  }
+
+  /**
+   * \returns The \p (i,j) element of the matrix.
+   */
+  T operator() (const unsigned int i,
+                const unsigned int j) const
+  {
+    libmesh_assert_less (i, M);
+    libmesh_assert_less (j, N);
+    return _val[i*N + j];
+  }
+
+  /**
+   * \returns The \p (i,j) element of the matrix as a writable
+   * reference.
+   */
+  T & operator() (const unsigned int i,
+                  const unsigned int j)
+  {
+    libmesh_assert_less (i, M);
+    libmesh_assert_less (j, N);
+    return _val[i*N + j];
+  }
+
+  /**
+   * \returns The matrix product (*this) * \p B.
+   */
+  template <unsigned int P>
+  FixedDenseMatrix<T,M,P> operator* (const FixedDenseMatrix<T,N,P> & B) const
+  {
+    FixedDenseMatrix<T,M,P> C;
+    DenseKernels::multiply_add<P>(M, N, C.get_values().data(),
+                                  _val.data(), B.get_values().data());
+    return C;
+  }
+
+  /**
+   * \returns The matrix product (*this)^T * \p B.  Zero entries of
+   * *this are skipped, which makes this cheap for sparse constraint
+   * matrices.
+   */
+  template <unsigned int P>
+  FixedDenseMatrix<T,N,P> transpose_multiply (const FixedDenseMatrix<T,M,P> & B) const
+  {
+    FixedDenseMatrix<T,N,P> C;
+    DenseKernels::transpose_multiply_add<P>(N, M, C.get_values().data(),
+                                            _val.data(), B.get_values().data());
+    return C;
+  }
+
+  /**
+   * Performs the matrix-vector multiplication,
+   * \p dest := (*this) * \p arg.
+   */
+  void vector_mult (FixedDenseVector<T,M> & dest,
+                    const FixedDenseVector<T,N> & arg) const
+  {
+    DenseKernels::vector_mult<N>(M, dest.get_values().data(),
+                                 _val.data(), arg.get_values().data());
+  }
+
+  /**
+   * Puts the transpose of *this into \p dest.
+   */
+  void get_transpose (FixedDenseMatrix<T,N,M> & dest) const
+  {
+    dest.zero();
+    for (unsigned int i=0; i != M; ++i)
+      for (unsigned int j=0; j != N; ++j)
+        dest(j,i) = _val[i*N + j];
+  }
+
+  /**
+   * Copies this matrix into \p dest, resizing it to (M x N).
+   */
+  void get_dense_matrix (DenseMatrix<T> & dest) const
+  {
+    dest.resize(M, N);
+    std::vector<T> & dest_vals = dest.get_values();
+    for (unsigned int i=0; i != M*N; ++i)
+      dest_vals[i] = _val[i];
+  }
+
+  /**
+   * Solve the system Ax=b given the input vector b.  Partial pivoting
+   * is performed by default in order to keep the algorithm stable to
+   * the effects of round-off error.
+   */
+  void lu_solve (const FixedDenseVector<T,N> & b,
+                 FixedDenseVector<T,N> & x)
+  {
+    static_assert(M == N, "lu_solve requires a square matrix");
+
+    if (_decomposition_type == NONE)
+      {
+        libmesh_error_msg_if(!DenseKernels::lu_decompose<N>(_val.data(), _pivots.data()),
+                             "Matrix A is singular!");
+        _decomposition_type = LU;
+      }
+    else
+      libmesh_error_msg_if(_decomposition_type != LU,
+                           "Error! This matrix already has a different decomposition...");
+
+    DenseKernels::lu_back_substitute<N>(_val.data(), _pivots.data(),
+                                        b.get_values().data(),
+                                        x.get_values().data());
+  }
+
+  /**
+   * For symmetric positive definite (SPD) matrices. A Cholesky
+   * factorization of A such that A = L L^T is about twice as fast as
+   * a standard LU factorization.
+   */
+  void cholesky_solve (const FixedDenseVector<T,N> & b,
+                       FixedDenseVector<T,N> & x)
+  {
+    static_assert(M == N, "cholesky_solve requires a square matrix");
+
+    if (_decomposition_type == NONE)
+      {
+        libmesh_error_msg_if(!DenseKernels::cholesky_decompose<N>(_val.data()),
+                             "Error! Can only use Cholesky decomposition with symmetric positive definite matrices.");
+        _decomposition_type = CHOLESKY;
+      }
+    else
+      libmesh_error_msg_if(_decomposition_type != CHOLESKY,
+                           "Error! This matrix already has a different decomposition...");
+
+    DenseKernels::cholesky_back_substitute<N>(_val.data(),
+                                              b.get_values().data(),
+                                              x.get_values().data());
+  }
+
+  /**
+   * Access to the row-major values array.
+   */
+  std::array<T,M*N> & get_values() { return _val; }
+  const std::array<T,M*N> & get_values() const { return _val; }
+
+private:
+
+  /**
+   * The actual data values, stored row-major.
+   */
+  std::array<T,M*N> _val;
+
+  /**
+   * The factorization currently stored in _val, if any.
+   */
+  enum DecompositionType {LU, CHOLESKY, NONE};
+  DecompositionType _decomposition_type;
+
+  /**
+   * Row interchanges from the LU factorization.
+   */
+  std::array<unsigned int,M> _pivots;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FIXED_DENSE_MATRIX_H
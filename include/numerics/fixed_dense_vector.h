@@ -0,0 +1,124 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FIXED_DENSE_VECTOR_H
+#define LIBMESH_FIXED_DENSE_VECTOR_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_vector.h"
+
+// C++ includes
+#include <array>
+
+namespace libMesh
+{
+
+/**
+ * A dense vector whose size \p N is known at compile time, for use
+ * with \p FixedDenseMatrix.  Storage is a \p std::array, so these
+ * vectors never allocate and can live on the stack, and there are
+ * no virtual functions in the way of inlining.
+ *
+ * \date 2023
+ */
+template <typename T, unsigned int N>
+class FixedDenseVector
+{
+public:
+
+  /**
+   * Constructor.  Creates a zero vector.
+   */
+  FixedDenseVector() { _val.fill(T(0)); }
+
+  /**
+   * Copy-constructor, from a \p DenseVector of size \p N.
+   */
+  explicit
+  FixedDenseVector(const DenseVector<T> & other)
+  {
+    libmesh_assert_equal_to (other.size(), N);
+    for (unsigned int i=0; i != N; ++i)
+      _val[i] = other(i);
+  }
+
+  static constexpr unsigned int size() { return N; }
+
+  /**
+   * Sets all entries of the vector to 0.
+   */
+  void zero() { _val.fill(T(0)); }
+
+  /**
+   * \returns Entry \p i of the vector as a const reference.
+   */
+  const T & operator() (const unsigned int i) const
+  { libmesh_assert_less (i, N); return _val[i]; }
+
+  /**
+   * \returns Entry \p i of the vector as a writable reference.
+   */
+  T & operator() (const unsigned int i)
+  { libmesh_assert_less (i, N); return _val[i]; }
+
+  /**
+   * Adds \p factor times \p vec to this vector.
+   */
+  void add (const T factor, const FixedDenseVector<T,N> & vec)
+  {
+    for (unsigned int i=0; i != N; ++i)
+      _val[i] += factor * vec._val[i];
+  }
+
+  /**
+   * \returns The dot product of *this with \p vec.
+   */
+  T dot (const FixedDenseVector<T,N> & vec) const
+  {
+    T sum = 0.;
+    for (unsigned int i=0; i != N; ++i)
+      sum += _val[i] * vec._val[i];
+    return sum;
+  }
+
+  /**
+   * Copies this vector into \p dest, resizing it to \p N.
+   */
+  void get_dense_vector (DenseVector<T> & dest) const
+  {
+    dest.resize(N);
+    for (unsigned int i=0; i != N; ++i)
+      dest(i) = _val[i];
+  }
+
+  /**
+   * Access to the values array.
+   */
+  std::array<T,N> & get_values() { return _val; }
+  const std::array<T,N> & get_values() const { return _val; }
+
+private:
+
+  std::array<T,N> _val;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FIXED_DENSE_VECTOR_H
@@ -0,0 +1,300 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_VECTOR_KERNELS_H
+#define LIBMESH_VECTOR_KERNELS_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/tensor_tools.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * Threaded kernels for the local part of vector operations.  The
+ * local values are split into contiguous chunks which are processed
+ * in parallel on the libMesh threads, and reductions add up the
+ * partial results of the chunks in chunk order, so results never
+ * depend on thread scheduling.
+ *
+ * A vector is split into one chunk per thread, so results are
+ * reproducible from run to run with the same number of threads.  If
+ * libMesh is configured with --enable-reproducible-reductions the
+ * chunks of reductions instead have a fixed size, which makes them
+ * give bitwise identical results for any number of threads, at the
+ * cost of a little extra work on short vectors.  Elementwise
+ * operations give the same results however they are split, so they
+ * always use one chunk per thread.
+ *
+ * The loops inside each chunk work on raw contiguous arrays, with
+ * several independent accumulators for reductions, so that the
+ * compiler is free to vectorize them.
+ */
+namespace VectorKernels
+{
+
+/**
+ * Vectors shorter than this are processed on the calling thread;
+ * starting threads would cost more than it saves.
+ */
+const std::size_t min_threaded_size = 65536;
+
+/**
+ * The chunk size used with --enable-reproducible-reductions.
+ */
+const std::size_t reproducible_chunk_size = 4096;
+
+/**
+ * \returns The number of chunks a vector with \p n local values is
+ * split into for elementwise operations.
+ */
+inline
+std::size_t n_chunks (std::size_t n)
+{
+  if (n < min_threaded_size || Threads::in_threads)
+    return 1;
+
+  return libMesh::n_threads();
+}
+
+/**
+ * \returns The first index of chunk \p c of \p n_chunks, for a vector
+ * with \p n local values.
+ */
+inline
+std::size_t chunk_begin (std::size_t n, std::size_t n_chunks, std::size_t c)
+{
+  return c * n / n_chunks;
+}
+
+/**
+ * \returns The number of chunks a vector with \p n local values is
+ * split into for reductions.
+ */
+inline
+std::size_t n_reduction_chunks (std::size_t n)
+{
+#ifdef LIBMESH_ENABLE_REPRODUCIBLE_REDUCTIONS
+  return std::max(std::size_t(1),
+                  (n + reproducible_chunk_size - 1) / reproducible_chunk_size);
+#else
+  return n_chunks(n);
+#endif
+}
+
+/**
+ * \returns The first index of reduction chunk \p c of \p n_chunks,
+ * for a vector with \p n local values.
+ */
+inline
+std::size_t reduction_chunk_begin (std::size_t n, std::size_t n_chunks, std::size_t c)
+{
+#ifdef LIBMESH_ENABLE_REPRODUCIBLE_REDUCTIONS
+  libmesh_ignore(n_chunks);
+  return std::min(c * reproducible_chunk_size, n);
+#else
+  return chunk_begin(n, n_chunks, c);
+#endif
+}
+
+/**
+ * Calls \p op(begin, end) on every chunk of the index range [0, n),
+ * in parallel if there is more than one chunk and we are not
+ * already running threaded.
+ */
+template <typename Op>
+inline
+void for_each_chunk (std::size_t n, const Op & op)
+{
+  const std::size_t nc = n_chunks(n);
+
+  if (nc == 1)
+    {
+      op(std::size_t(0), n);
+      return;
+    }
+
+  auto body =
+    [n, nc, &op](const Threads::BlockedRange<std::size_t> & range)
+    {
+      for (std::size_t c = range.begin(); c != range.end(); ++c)
+        op(chunk_begin(n, nc, c), chunk_begin(n, nc, c+1));
+    };
+
+  const Threads::BlockedRange<std::size_t> chunk_range(0, nc, 1);
+
+  if (libMesh::n_threads() > 1 && !Threads::in_threads)
+    Threads::parallel_for(chunk_range, body);
+  else
+    body(chunk_range);
+}
+
+/**
+ * \returns The combination, via \p combine, of the results of
+ * \p op(begin, end) on every chunk of [0, n), taken in chunk order.
+ */
+template <typename R, typename Op, typename Combine>
+inline
+R reduce_chunks (std::size_t n, const Op & op, const Combine & combine)
+{
+  const std::size_t nc = n_reduction_chunks(n);
+
+  if (nc == 1)
+    return op(std::size_t(0), n);
+
+  std::vector<R> partials(nc);
+
+  auto body =
+    [n, nc, &op, &partials](const Threads::BlockedRange<std::size_t> & range)
+    {
+      for (std::size_t c = range.begin(); c != range.end(); ++c)
+        partials[c] = op(reduction_chunk_begin(n, nc, c),
+                         reduction_chunk_begin(n, nc, c+1));
+    };
+
+  const Threads::BlockedRange<std::size_t> chunk_range(0, nc, 1);
+
+  // Fixed size chunks of a short vector are still summed on the
+  // calling thread
+  if (libMesh::n_threads() > 1 && !Threads::in_threads &&
+      n >= min_threaded_size)
+    Threads::parallel_for(chunk_range, body);
+  else
+    body(chunk_range);
+
+  R result = partials[0];
+  for (std::size_t c = 1; c != nc; ++c)
+    result = combine(result, partials[c]);
+
+  return result;
+}
+
+/**
+ * \returns The sum of \p f(i) for i in [begin, end), accumulated in
+ * four interleaved partial sums so the loop can be vectorized.
+ */
+template <typename R, typename F>
+inline
+R unrolled_sum (std::size_t begin, std::size_t end, const F & f)
+{
+  R s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+
+  std::size_t i = begin;
+  for (; i + 4 <= end; i += 4)
+    {
+      s0 += f(i);
+      s1 += f(i+1);
+      s2 += f(i+2);
+      s3 += f(i+3);
+    }
+  for (; i != end; ++i)
+    s0 += f(i);
+
+  return (s0 + s1) + (s2 + s3);
+}
+
+/**
+ * \returns The sum of the \p n entries of \p x.
+ */
+template <typename T>
+inline
+T sum (const T * x, std::size_t n)
+{
+  return reduce_chunks<T>
+    (n,
+     [x](std::size_t begin, std::size_t end)
+     { return unrolled_sum<T>(begin, end, [x](std::size_t i) { return x[i]; }); },
+     [](const T & a, const T & b) { return a + b; });
+}
+
+/**
+ * \returns The sum of the absolute values of the \p n entries of \p x.
+ */
+template <typename T>
+inline
+Real sum_abs (const T * x, std::size_t n)
+{
+  return reduce_chunks<Real>
+    (n,
+     [x](std::size_t begin, std::size_t end)
+     { return unrolled_sum<Real>(begin, end, [x](std::size_t i) { return Real(std::abs(x[i])); }); },
+     [](Real a, Real b) { return a + b; });
+}
+
+/**
+ * \returns The sum of the squared norms of the \p n entries of \p x.
+ */
+template <typename T>
+inline
+Real sum_norm_sq (const T * x, std::size_t n)
+{
+  return reduce_chunks<Real>
+    (n,
+     [x](std::size_t begin, std::size_t end)
+     { return unrolled_sum<Real>(begin, end, [x](std::size_t i) { return Real(TensorTools::norm_sq(x[i])); }); },
+     [](Real a, Real b) { return a + b; });
+}
+
+/**
+ * \returns The largest absolute value of the \p n entries of \p x, or
+ * zero if \p n is zero.
+ */
+template <typename T>
+inline
+Real max_abs (const T * x, std::size_t n)
+{
+  return reduce_chunks<Real>
+    (n,
+     [x](std::size_t begin, std::size_t end)
+     {
+       Real m = 0;
+       for (std::size_t i = begin; i != end; ++i)
+         m = std::max(m, Real(std::abs(x[i])));
+       return m;
+     },
+     [](Real a, Real b) { return std::max(a, b); });
+}
+
+/**
+ * \returns The sum of x[i]*y[i] over the \p n entries of \p x and
+ * \p y.  Note that neither argument is conjugated.
+ */
+template <typename T>
+inline
+T dot (const T * x, const T * y, std::size_t n)
+{
+  return reduce_chunks<T>
+    (n,
+     [x, y](std::size_t begin, std::size_t end)
+     { return unrolled_sum<T>(begin, end, [x, y](std::size_t i) { return x[i] * y[i]; }); },
+     [](const T & a, const T & b) { return a + b; });
+}
+
+} // namespace VectorKernels
+
+} // namespace libMesh
+
+#endif // LIBMESH_VECTOR_KERNELS_H
@@ -55,6 +55,26 @@ template <typename KeyType, typename IdxType=unsigned int>
 class Sort : public ParallelObject
 {
 public:
+  /**
+   * The algorithms available for splitting the keys into one bin
+   * per processor.
+   *
+   * BIN_SORT refines global histograms of the key range until the
+   * bins are balanced.  Each refinement sums a histogram with many
+   * entries per processor, which gets expensive on large
+   * communicators.
+   *
+   * SAMPLE_SORT gathers a few regularly spaced keys from every
+   * processor onto processor 0, which picks the bin boundaries from
+   * them and broadcasts them.  It takes a fixed number of collective
+   * operations, and the bins are balanced to within the sampling
+   * resolution.
+   *
+   * The default is BIN_SORT, unless "--parallel-sort sample" is given
+   * on the command line.
+   */
+  enum Method { BIN_SORT, SAMPLE_SORT };
+
   /**
    * Constructor takes the number of processors,
    * the processor id, and a reference to a vector of data
@@ -82,6 +102,16 @@ public:
    */
   const std::vector<KeyType> & bin();
 
+  /**
+   * Sets the algorithm used by sort().
+   */
+  void set_method (Method method) { _method = method; }
+
+  /**
+   * \returns The algorithm used by sort().
+   */
+  Method method () const { return _method; }
+
 private:
 
   /**
@@ -99,6 +129,11 @@ private:
    */
   bool _bin_is_sorted;
 
+  /**
+   * The algorithm used to split the keys between processors
+   */
+  Method _method;
+
   /**
    * The raw, unsorted data which will need to
    * be sorted (in parallel) across all
@@ -128,6 +163,12 @@ private:
    */
   void binsort ();
 
+  /**
+   * Sorts the local data into bins across all processors, with bin
+   * boundaries chosen from a weighted sample of the keys.
+   */
+  void samplesort ();
+
   /**
    * Communicates the bins from each processor to the
    * appropriate processor.  By the time this function
@@ -213,7 +213,7 @@ private:
 template <typename Range>
 unsigned int num_pthreads(Range & range)
 {
-  std::size_t min = std::min((std::size_t)libMesh::n_threads(), range.size());
+  std::size_t min = std::min((std::size_t)libMesh::n_threads(), (std::size_t)range.size());
   return min > 0 ? cast_int<unsigned int>(min) : 1;
 }
 
@@ -279,10 +279,8 @@ void parallel_for (const Range & range, const Body & body)
   }
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
   if (libMesh::n_threads() > 1)
-    libMesh::perflog.disable_logging();
+    libMesh::perflog.enter_threaded_region();
 #endif
   unsigned int n_threads = num_pthreads(range);
 
@@ -348,8 +346,8 @@ void parallel_for (const Range & range, const Body & body)
     delete ranges[i];
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  if (libMesh::n_threads() > 1 && logging_was_enabled)
-    libMesh::perflog.enable_logging();
+  if (libMesh::n_threads() > 1)
+    libMesh::perflog.leave_threaded_region();
 #endif
 }
 
@@ -382,10 +380,8 @@ void parallel_reduce (const Range & range, Body & body)
   }
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
   if (libMesh::n_threads() > 1)
-    libMesh::perflog.disable_logging();
+    libMesh::perflog.enter_threaded_region();
 #endif
 
   unsigned int n_threads = num_pthreads(range);
@@ -464,8 +460,8 @@ void parallel_reduce (const Range & range, Body & body)
     delete ranges[i];
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  if (libMesh::n_threads() > 1 && logging_was_enabled)
-    libMesh::perflog.enable_logging();
+  if (libMesh::n_threads() > 1)
+    libMesh::perflog.leave_threaded_region();
 #endif
 }
 
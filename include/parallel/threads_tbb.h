@@ -89,10 +89,8 @@ void parallel_for (const Range & range, const Body & body)
   BoolAcquire b(in_threads);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
   if (libMesh::n_threads() > 1)
-    libMesh::perflog.disable_logging();
+    libMesh::perflog.enter_threaded_region();
 #endif
 
   if (libMesh::n_threads() > 1)
@@ -102,8 +100,8 @@ void parallel_for (const Range & range, const Body & body)
     body(range);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  if (libMesh::n_threads() > 1 && logging_was_enabled)
-    libMesh::perflog.enable_logging();
+  if (libMesh::n_threads() > 1)
+    libMesh::perflog.leave_threaded_region();
 #endif
 }
 
@@ -120,10 +118,8 @@ void parallel_for (const Range & range, const Body & body, const Partitioner & p
   BoolAcquire b(in_threads);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
   if (libMesh::n_threads() > 1)
-    libMesh::perflog.disable_logging();
+    libMesh::perflog.enter_threaded_region();
 #endif
 
   if (libMesh::n_threads() > 1)
@@ -133,8 +129,8 @@ void parallel_for (const Range & range, const Body & body, const Partitioner & p
     body(range);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  if (libMesh::n_threads() > 1 && logging_was_enabled)
-    libMesh::perflog.enable_logging();
+  if (libMesh::n_threads() > 1)
+    libMesh::perflog.leave_threaded_region();
 #endif
 }
 
@@ -151,10 +147,8 @@ void parallel_reduce (const Range & range, Body & body)
   BoolAcquire b(in_threads);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
   if (libMesh::n_threads() > 1)
-    libMesh::perflog.disable_logging();
+    libMesh::perflog.enter_threaded_region();
 #endif
 
   if (libMesh::n_threads() > 1)
@@ -164,8 +158,8 @@ void parallel_reduce (const Range & range, Body & body)
     body(range);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  if (libMesh::n_threads() > 1 && logging_was_enabled)
-    libMesh::perflog.enable_logging();
+  if (libMesh::n_threads() > 1)
+    libMesh::perflog.leave_threaded_region();
 #endif
 }
 
@@ -182,10 +176,8 @@ void parallel_reduce (const Range & range, Body & body, const Partitioner & part
   BoolAcquire b(in_threads);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
   if (libMesh::n_threads() > 1)
-    libMesh::perflog.disable_logging();
+    libMesh::perflog.enter_threaded_region();
 #endif
 
   if (libMesh::n_threads() > 1)
@@ -195,8 +187,8 @@ void parallel_reduce (const Range & range, Body & body, const Partitioner & part
     body(range);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  if (libMesh::n_threads() > 1 && logging_was_enabled)
-    libMesh::perflog.enable_logging();
+  if (libMesh::n_threads() > 1)
+    libMesh::perflog.leave_threaded_region();
 #endif
 }
 
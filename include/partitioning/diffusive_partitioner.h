@@ -0,0 +1,256 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DIFFUSIVE_PARTITIONER_H
+#define LIBMESH_DIFFUSIVE_PARTITIONER_H
+
+// Local Includes
+#include "libmesh/partitioner.h"
+#include "libmesh/enum_partitioner_type.h"
+
+// C++ Includes
+#include <memory>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class ElemCostTracker;
+
+/**
+ * The \p DiffusivePartitioner rebalances an existing partitioning by
+ * moving elements between neighboring processors only, so that the
+ * amount of data migrated is proportional to the imbalance rather
+ * than to the size of the mesh.
+ *
+ * Element weights are taken from an attached ElemCostTracker, i.e.
+ * from measured costs, if there is one; elements refined since the
+ * costs were measured get an equal share of their parent's cost, and
+ * elements with no measurement get the mean measured cost.  Without a
+ * tracker, weights attached with attach_weights() are used, and
+ * otherwise all elements weigh the same.
+ *
+ * The processor loads are balanced by first-order diffusion on the
+ * graph of neighboring processors, which gives the amount of work
+ * each processor should send to each of its neighbors.  Each
+ * processor then sends that much work by peeling off layers of
+ * elements along the interface with the receiving neighbor, preferring
+ * elements with many neighbors on the receiving side, which keeps the
+ * interfaces short.
+ *
+ * The first partitioning, and any partitioning into a number of parts
+ * other than the number of processors, is delegated to a partitioner
+ * of the type given by initial_partitioner_type().
+ *
+ * \date 2023
+ * \brief Incremental partitioner which balances measured costs.
+ */
+class DiffusivePartitioner : public Partitioner
+{
+public:
+
+  /**
+   * Load balancing statistics of the last partitioning.  Loads are
+   * the sums of the element weights on each processor, and the
+   * imbalance is the largest load divided by the mean load.
+   */
+  struct Statistics
+  {
+    /**
+     * The imbalance before partitioning.
+     */
+    Real imbalance_before = 1.;
+
+    /**
+     * The imbalance after partitioning.
+     */
+    Real imbalance_after = 1.;
+
+    /**
+     * The number of active elements assigned to a new processor.
+     * Only computed for incremental partitionings.
+     */
+    dof_id_type n_elem_moved = 0;
+
+    /**
+     * An estimate of the number of bytes the moved elements and their
+     * nodes take up in the buffers used to redistribute the mesh.
+     * Only computed for incremental partitionings.
+     */
+    std::size_t bytes_moved = 0;
+
+    /**
+     * Whether the partitioning was incremental, or was delegated to
+     * the initial partitioner.
+     */
+    bool incremental = false;
+  };
+
+  /**
+   * Constructor.
+   */
+  DiffusivePartitioner ();
+
+  /**
+   * Copy ctor.  The initial partitioner is not copied; the copy
+   * builds its own when it needs one.
+   */
+  DiffusivePartitioner (const DiffusivePartitioner & other);
+
+  /**
+   * This class contains a unique_ptr member, so it can't be default
+   * copy assigned.
+   */
+  DiffusivePartitioner & operator= (const DiffusivePartitioner &) = delete;
+
+  /**
+   * Move ctor, move assignment operator, and destructor are
+   * all explicitly defaulted for this class.
+   */
+  DiffusivePartitioner (DiffusivePartitioner &&) = default;
+  DiffusivePartitioner & operator= (DiffusivePartitioner &&) = default;
+  virtual ~DiffusivePartitioner() = default;
+
+  virtual PartitionerType type () const override;
+
+  /**
+   * \returns A copy of this partitioner wrapped in a smart pointer.
+   */
+  virtual std::unique_ptr<Partitioner> clone () const override
+  {
+    return std::make_unique<DiffusivePartitioner>(*this);
+  }
+
+  /**
+   * Uses the costs measured by \p tracker as element weights.  The
+   * tracker is not copied, and must outlive its use here; pass
+   * \p nullptr to detach it.
+   */
+  void set_cost_tracker (const ElemCostTracker * tracker)
+  { _cost_tracker = tracker; }
+
+  /**
+   * Attach weights to be used when no cost tracker is attached.  This
+   * ErrorVector should be _exactly_ the same on every processor and
+   * should have mesh->max_elem_id() entries.
+   */
+  virtual void attach_weights(ErrorVector * weights) override { _weights = weights; }
+
+  /**
+   * Sets the type of partitioner used for the first partitioning.
+   * Defaults to PARMETIS_PARTITIONER.
+   */
+  void set_initial_partitioner_type (PartitionerType type);
+
+  PartitionerType initial_partitioner_type () const
+  { return _initial_partitioner_type; }
+
+  /**
+   * Sets the largest imbalance left after an incremental
+   * partitioning; the diffusion stops once the loads are balanced to
+   * within this tolerance.  Defaults to 1.05.
+   */
+  void set_imbalance_tolerance (Real tol) { _imbalance_tolerance = tol; }
+
+  /**
+   * If \p verbose is \p true, the statistics of each partitioning are
+   * printed on processor 0.
+   */
+  void set_verbose (bool verbose) { _verbose = verbose; }
+
+  /**
+   * \returns The load balancing statistics of the last partitioning.
+   */
+  const Statistics & last_statistics () const { return _statistics; }
+
+protected:
+
+  /**
+   * Partitions the \p MeshBase into \p n subdomains, incrementally if
+   * it has been partitioned before.
+   */
+  virtual void _do_partition (MeshBase & mesh,
+                              const unsigned int n) override;
+
+  /**
+   * Repartitions the \p MeshBase into \p n subdomains, incrementally
+   * if possible.
+   */
+  virtual void _do_repartition (MeshBase & mesh,
+                                const unsigned int n) override;
+
+private:
+
+  /**
+   * Moves elements between neighboring processors to balance the
+   * loads.
+   */
+  void _diffuse (MeshBase & mesh);
+
+  /**
+   * Delegates the partitioning to the initial partitioner.
+   */
+  void _initial_partition (MeshBase & mesh,
+                           const unsigned int n);
+
+  /**
+   * \returns The weight of \p elem, or \p default_w if we have a cost
+   * tracker but no cost for \p elem.
+   */
+  Real _elem_weight (const Elem & elem, Real default_w) const;
+
+  /**
+   * \returns The sum of the weights of the active elements on each
+   * processor.
+   */
+  std::vector<Real> _processor_loads (const MeshBase & mesh,
+                                      Real default_w) const;
+
+  /**
+   * \returns The largest of \p loads divided by their mean.
+   */
+  static Real _imbalance (const std::vector<Real> & loads);
+
+  /**
+   * Prints the statistics of the last partitioning on processor 0.
+   */
+  void _print_statistics (const MeshBase & mesh) const;
+
+  PartitionerType _initial_partitioner_type;
+
+  std::unique_ptr<Partitioner> _initial_partitioner;
+
+  const ElemCostTracker * _cost_tracker;
+
+  Real _imbalance_tolerance;
+
+  bool _verbose;
+
+  /**
+   * Whether we have produced a partitioning that later calls can
+   * improve on incrementally.
+   */
+  bool _has_partitioned;
+
+  Statistics _statistics;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_DIFFUSIVE_PARTITIONER_H
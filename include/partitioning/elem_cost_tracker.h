@@ -0,0 +1,138 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_COST_TRACKER_H
+#define LIBMESH_ELEM_COST_TRACKER_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+#include "libmesh/threads.h"
+
+// C++ Includes
+#include <chrono>
+#include <unordered_map>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class Elem;
+
+/**
+ * The \p ElemCostTracker accumulates the measured cost, in seconds,
+ * of the work done on each element, typically by timing the element
+ * loops of assembly with an ElemCostTracker::Timer.  The
+ * DiffusivePartitioner uses these costs as element weights.
+ *
+ * Costs are accumulated on the processor which does the work, so
+ * each processor only knows the costs of its own elements.  Costs
+ * may be added from several threads at once.
+ *
+ * \date 2023
+ * \brief Accumulates measured per-element costs.
+ */
+class ElemCostTracker
+{
+public:
+
+  /**
+   * Times the lifetime of the object and adds the elapsed time to
+   * the cost of \p elem.  Does nothing if \p tracker is \p nullptr,
+   * so that instrumented loops cost nothing when no tracker is
+   * attached.
+   */
+  class Timer
+  {
+  public:
+    Timer (ElemCostTracker * tracker,
+           const Elem & elem) :
+      _tracker(tracker),
+      _elem(elem)
+    {
+      if (_tracker)
+        _start = std::chrono::steady_clock::now();
+    }
+
+    ~Timer ()
+    {
+      if (_tracker)
+        {
+          const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - _start;
+          _tracker->add_cost(_elem, elapsed.count());
+        }
+    }
+
+    Timer (const Timer &) = delete;
+    Timer & operator= (const Timer &) = delete;
+
+  private:
+    ElemCostTracker * _tracker;
+    const Elem & _elem;
+    std::chrono::steady_clock::time_point _start;
+  };
+
+  ElemCostTracker () = default;
+
+  /**
+   * Adds \p cost to the accumulated cost of \p elem.  Thread safe.
+   */
+  void add_cost (const Elem & elem, double cost);
+
+  /**
+   * \returns The accumulated cost of \p elem, or zero if no cost has
+   * been measured for it.
+   */
+  double cost (const Elem & elem) const;
+
+  /**
+   * \returns \p true if a cost has been measured for \p elem.
+   */
+  bool has_cost (const Elem & elem) const;
+
+  /**
+   * \returns The number of elements with a measured cost.
+   */
+  std::size_t n_measured () const { return _costs.size(); }
+
+  /**
+   * Forgets all the measured costs.  Costs are stored by element id
+   * on the processor which measured them, so this should be called
+   * after elements have been redistributed and before the next round
+   * of measurements.
+   */
+  void clear ();
+
+private:
+
+  /**
+   * The accumulated costs, by element id.
+   */
+  std::unordered_map<dof_id_type, double> _costs;
+
+  /**
+   * Serializes add_cost() calls from different threads.
+   */
+  Threads::spin_mutex _mutex;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_COST_TRACKER_H
@@ -0,0 +1,150 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_HIERARCHICAL_PARTITIONER_H
+#define LIBMESH_HIERARCHICAL_PARTITIONER_H
+
+// Local Includes
+#include "libmesh/partitioner.h"
+
+// C++ Includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * The \p HierarchicalPartitioner partitions the elements in two
+ * levels: first among the compute nodes, i.e. the groups of
+ * processors which share memory, and then among the processors on
+ * each node.  Communication between processors on the same node is
+ * much cheaper than communication between nodes, so the first level
+ * minimizes the expensive part of the communication volume, and the
+ * second level only has to balance the work within each node.
+ *
+ * The nodes are found with MPI_Comm_split_type(MPI_COMM_TYPE_SHARED),
+ * unless the number of processors per node is set explicitly with
+ * set_n_ranks_per_node(), in which case each node is a block of
+ * consecutive processor ids.  When partitioning into a number of
+ * parts other than the number of processors, the parts are grouped
+ * the same way if the number of ranks per node has been set, and
+ * otherwise the partitioning is a single level.
+ *
+ * Each level is partitioned by an internal Partitioner, MetisPartitioner
+ * by default, via partition_range(), so any Partitioner which
+ * implements partition_range() can be used at either level, with the
+ * same restrictions it has on its own.  Each node gets work in
+ * proportion to its number of processors.  The first level
+ * partitions into one part per node; if the nodes have different
+ * numbers of processors, a MetisPartitioner is given target part
+ * weights for that.  Otherwise, the first level must be a Linear or
+ * space filling curve partitioner, which numbers its parts in order
+ * along the curve: it partitions into one part per processor, and
+ * each node takes a block of consecutive parts.
+ *
+ * \date 2023
+ * \brief Partitions among compute nodes, then among the processors on each node.
+ */
+class HierarchicalPartitioner : public Partitioner
+{
+public:
+
+  /**
+   * Constructors. The default ctor initializes both internal
+   * Partitioner objects to MetisPartitioners so the class is usable,
+   * although these types can be customized later.
+   */
+  HierarchicalPartitioner ();
+  HierarchicalPartitioner (const HierarchicalPartitioner & other);
+
+  /**
+   * This class contains unique_ptr members, so it can't be default
+   * copy assigned.
+   */
+  HierarchicalPartitioner & operator= (const HierarchicalPartitioner &) = delete;
+
+  /**
+   * Move ctor, move assignment operator, and destructor are
+   * all explicitly defaulted for this class.
+   */
+  HierarchicalPartitioner (HierarchicalPartitioner &&) = default;
+  HierarchicalPartitioner & operator= (HierarchicalPartitioner &&) = default;
+  virtual ~HierarchicalPartitioner() = default;
+
+  virtual PartitionerType type () const override;
+
+  /**
+   * \returns A copy of this partitioner wrapped in a smart pointer.
+   */
+  virtual std::unique_ptr<Partitioner> clone () const override
+  {
+    return std::make_unique<HierarchicalPartitioner>(*this);
+  }
+
+  /**
+   * Get a reference to the Partitioner used to partition the mesh
+   * among the compute nodes.
+   *
+   * \note Neither internal Partitioner can be a
+   * HierarchicalPartitioner.
+   */
+  std::unique_ptr<Partitioner> & node_partitioner() { return _node_partitioner; }
+
+  /**
+   * Get a reference to the Partitioner used to partition the
+   * elements of each compute node among its processors.
+   */
+  std::unique_ptr<Partitioner> & core_partitioner() { return _core_partitioner; }
+
+  /**
+   * Groups the parts into blocks of \p n consecutive parts, one per
+   * compute node, instead of querying MPI for the processors which
+   * share memory.  Pass 0 to query MPI again.
+   */
+  void set_n_ranks_per_node (unsigned int n) { _n_ranks_per_node = n; }
+
+protected:
+
+  /**
+   * Partition the \p MeshBase into \p n subdomains.
+   */
+  virtual void _do_partition (MeshBase & mesh,
+                              const unsigned int n) override;
+
+private:
+
+  /**
+   * \returns The parts on each compute node, in increasing order, for
+   * a partitioning into \p n parts.
+   */
+  std::vector<std::vector<processor_id_type>>
+  _node_groups (const MeshBase & mesh,
+                const unsigned int n) const;
+
+  std::unique_ptr<Partitioner> _node_partitioner;
+
+  std::unique_ptr<Partitioner> _core_partitioner;
+
+  unsigned int _n_ranks_per_node;
+};
+
+} // namespace libMesh
+
+#endif  // LIBMESH_HIERARCHICAL_PARTITIONER_H
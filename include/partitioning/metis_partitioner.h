@@ -25,6 +25,7 @@
 
 // C++ Includes
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -64,6 +65,18 @@ public:
 
   virtual void attach_weights(ErrorVector * weights) override { _weights = weights; }
 
+  /**
+   * Sets the fraction of the total element weight which each part
+   * should get, in proportion to the entries of \p weights, instead
+   * of giving every part the same share.  \p weights needs one entry
+   * per part; pass an empty vector to go back to equal parts.
+   *
+   * \note Without the Metis library the SFCPartitioner we fall back
+   * on ignores these weights.
+   */
+  void set_target_part_weights(std::vector<Real> weights)
+  { _target_part_weights = std::move(weights); }
+
   /**
    * Called by the SubdomainPartitioner to partition elements in the range (it, end).
    */
@@ -79,6 +92,14 @@ protected:
    */
   virtual void _do_partition (MeshBase & mesh,
                               const unsigned int n) override;
+
+private:
+
+  /**
+   * The relative share of the element weight for each part, or empty
+   * for equal shares.
+   */
+  std::vector<Real> _target_part_weights;
 };
 
 } // namespace libMesh
@@ -284,30 +284,118 @@ protected:
     bool kdtree_get_bbox(BBOX & /* bb */) const { return false; }
   };
 
-  PointListAdaptor<KDDim> _point_list_adaptor;
+  /**
+   * This class adapts a contiguous slice of an index list into a
+   * list of libMesh \p Point types, so that each of several KD-Trees
+   * can index a disjoint subset of the source points.  Indices
+   * returned by a tree built on this adaptor are local to the slice.
+   */
+  template <unsigned int PLDim>
+  class PointSubsetAdaptor
+  {
+  private:
+    const std::vector<Point> & _pts;
+    const std::size_t * _indices;
+    std::size_t _n_indices;
 
-  // template <int KDDIM>
-  // class KDTree : public KDTreeSingleIndexAdaptor<L2_Simple_Adaptor<num_t, PointListAdaptor >,
-  //  PointListAdaptor,
-  //  KDDIM>
-  // {
-  // };
+  public:
+    PointSubsetAdaptor (const std::vector<Point> & pts,
+                        const std::size_t * indices,
+                        std::size_t n_indices) :
+      _pts(pts),
+      _indices(indices),
+      _n_indices(n_indices)
+    {}
 
-  typedef nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Simple_Adaptor<Real, PointListAdaptor<KDDim>>,
-                                              PointListAdaptor<KDDim>, KDDim, std::size_t> kd_tree_t;
+    typedef Real coord_t;
 
-  mutable std::unique_ptr<kd_tree_t> _kd_tree;
+    inline size_t kdtree_get_point_count() const { return _n_indices; }
+
+    /**
+     * \returns The global index in the source point list of the
+     * idx'th point of this slice.
+     */
+    inline std::size_t global_index(const size_t idx) const
+    {
+      libmesh_assert_less (idx, _n_indices);
+      return _indices[idx];
+    }
+
+    inline coord_t kdtree_get_pt(const size_t idx, int dim) const
+    {
+      libmesh_assert_less (dim, PLDim);
+      libmesh_assert_less (dim, 3);
+
+      const Point & p(_pts[this->global_index(idx)]);
+
+      if (dim==0) return p(0);
+      if (dim==1) return p(1);
+      return p(2);
+    }
+
+    template <class BBOX>
+    bool kdtree_get_bbox(BBOX & /* bb */) const { return false; }
+  };
+
+  typedef nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Simple_Adaptor<Real, PointSubsetAdaptor<KDDim>>,
+                                              PointSubsetAdaptor<KDDim>, KDDim, std::size_t> kd_tree_t;
+
+  /**
+   * The source points are split into spatially contiguous slabs
+   * along the longest axis of their bounding box, and one KD-Tree is
+   * built per slab so that the trees can be constructed
+   * concurrently.  \p _kd_order holds the source point indices
+   * sorted into slabs, with slab \p t occupying
+   * [_kd_offsets[t], _kd_offsets[t+1]).
+   */
+  std::vector<std::size_t> _kd_order;
+  std::vector<std::size_t> _kd_offsets;
+
+  /**
+   * The axis along which the slabs are cut, and the extent of each
+   * slab along that axis.  Queries use these to skip slabs which
+   * cannot contain a closer point.
+   */
+  unsigned int _kd_axis;
+  std::vector<std::pair<Real, Real>> _kd_slab_bounds;
+
+  std::vector<PointSubsetAdaptor<KDDim>> _kd_adaptors;
+
+  mutable std::vector<std::unique_ptr<kd_tree_t>> _kd_trees;
+
+  /**
+   * Finds the (up to) \p n_results source points closest to \p pt,
+   * sorted from closest to farthest.  Safe to call concurrently
+   * from multiple threads once the trees have been built.
+   */
+  void knn_search (const Point & pt,
+                   std::size_t n_results,
+                   std::vector<size_t> & indices,
+                   std::vector<Real> & dist_sqr) const;
+
+  /**
+   * Finds all source points within squared distance \p radius_sqr
+   * of \p pt, as (index, squared distance) pairs in no particular
+   * order.  Safe to call concurrently from multiple threads once the
+   * trees have been built.
+   */
+  void radius_search (const Point & pt,
+                      Real radius_sqr,
+                      std::vector<std::pair<std::size_t, Real>> & matches) const;
 
 #endif // LIBMESH_HAVE_NANOFLANN
 
   /**
-   * Build & initialize the KD tree, if needed.
+   * Build & initialize the KD trees, if needed.  With more than one
+   * thread available the source points are split into one slab per
+   * thread and the slab trees are built in parallel.
    */
   virtual void construct_kd_tree ();
 
   /**
    * Performs inverse distance interpolation at the input point from
-   * the specified points.
+   * the specified points.  This is called concurrently from several
+   * threads, so it must not modify the object.
    */
   virtual void interpolate (const Point               & pt,
                             const std::vector<size_t> & src_indices,
@@ -319,6 +407,10 @@ protected:
 
   /**
    * Temporary work array.  Object level scope to avoid cache thrashing.
+   *
+   * \deprecated interpolate() no longer uses this array, since it is
+   * called concurrently from several threads.  It is kept only for
+   * subclasses which still use it, and will be removed.
    */
   mutable std::vector<Number> _vals;
 
@@ -333,7 +425,7 @@ public:
                                 const Real  power               = 2) :
     MeshfreeInterpolation(comm_in),
 #if LIBMESH_HAVE_NANOFLANN
-    _point_list_adaptor(_src_pts),
+    _kd_axis(0),
 #endif
     _half_power(power/2.0),
     _n_interp_pts(n_interp_pts)
@@ -42,6 +42,29 @@ namespace libMesh
 template <unsigned int KDDim, class RBF = WendlandRBF<KDDim, 2>>
 class RadialBasisInterpolation : public InverseDistanceInterpolation<KDDim>
 {
+public:
+
+  /**
+   * How the interpolation system is assembled and solved.
+   *
+   * DENSE assembles the full (n_src x n_src) matrix and factors it
+   * directly, which is only practical for a few thousand source
+   * points.
+   *
+   * SPARSE exploits the compact support of the (Wendland) basis: each
+   * matrix row is assembled from a KD-Tree radius query, rows are
+   * built concurrently, and the resulting sparse symmetric positive
+   * definite system is solved with preconditioned conjugate
+   * gradients.  Evaluation likewise only visits source points within
+   * the support radius.  This mode requires an explicit support
+   * radius which is small relative to the extent of the source
+   * points.
+   */
+  enum SolveType {DENSE = 0,
+                  SPARSE};
+
+protected:
+
   /**
    * Bring base class data into our namespace.
    */
@@ -49,8 +72,6 @@ class RadialBasisInterpolation : public InverseDistanceInterpolation<KDDim>
   using InverseDistanceInterpolation<KDDim>::_src_vals;
   using InverseDistanceInterpolation<KDDim>::_names;
 
-protected:
-
   /**
    * Bounding box for our source points.
    */
@@ -71,18 +92,69 @@ protected:
    */
   Real _r_override;
 
+  /**
+   * How to assemble and solve the interpolation system.
+   */
+  SolveType _solve_type;
+
+  /**
+   * Relative residual tolerance and iteration limit for the
+   * iterative solve used in \p SPARSE mode.
+   */
+  Real _solver_tolerance;
+  unsigned int _solver_max_its;
+
+  /**
+   * Assembles the compactly supported interpolation matrix from
+   * KD-Tree radius queries and solves it iteratively.
+   */
+  void solve_sparse (const RBF & rbf);
+
+  /**
+   * Assembles and factors the full interpolation matrix.
+   */
+  void solve_dense (const RBF & rbf);
+
 public:
 
   /**
-   * Constructor.
+   * Constructor.  If \p radius is positive it is used as the support
+   * radius of the basis functions, otherwise the diagonal of the
+   * source point bounding box is used.
    */
   RadialBasisInterpolation (const libMesh::Parallel::Communicator & comm_in,
-                            Real radius=-1) :
+                            Real radius=-1,
+                            SolveType solve_type=DENSE) :
     InverseDistanceInterpolation<KDDim> (comm_in,8,2),
     _r_bbox(0.),
-    _r_override(radius)
+    _r_override(radius),
+    _solve_type(solve_type),
+    _solver_tolerance(TOLERANCE*TOLERANCE),
+    _solver_max_its(1000)
   { }
 
+  /**
+   * Sets how the interpolation system is assembled and solved.
+   */
+  void set_solve_type (SolveType solve_type)
+  { _solve_type = solve_type; }
+
+  /**
+   * \returns How the interpolation system is assembled and solved.
+   */
+  SolveType solve_type () const
+  { return _solve_type; }
+
+  /**
+   * Sets the relative residual tolerance and maximum number of
+   * iterations for the \p SPARSE mode solve.
+   */
+  void set_solver_parameters (Real tolerance, unsigned int max_its)
+  {
+    _solver_tolerance = tolerance;
+    _solver_max_its = max_its;
+  }
+
   /**
    * Clears all internal data structures and restores to a
    * pristine state.
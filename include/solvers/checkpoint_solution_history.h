@@ -0,0 +1,157 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_CHECKPOINT_SOLUTION_HISTORY_H
+#define LIBMESH_CHECKPOINT_SOLUTION_HISTORY_H
+
+#include "libmesh/solution_history.h"
+#include "libmesh/compressed_history_data.h"
+#include "libmesh/diff_system.h"
+
+// C++ includes
+#include <memory>
+#include <set>
+
+namespace libMesh
+{
+
+/**
+ * Subclass of SolutionHistory that stores full solution snapshots for
+ * only a limited number of timesteps, recomputing the others from the
+ * nearest earlier snapshot when they are retrieved.
+ *
+ * During the primal solve every timestep is recorded, but once more
+ * than \p max_snapshots snapshots are held the one lowest in the
+ * dyadic hierarchy of time stamps (the one whose time stamp is
+ * divisible by the smallest power of two, oldest first among equals)
+ * is discarded, so the retained snapshots are sparse in the distant
+ * past and denser towards the present.  The initial condition is
+ * always kept.  When a discarded
+ * timestep is retrieved (typically while marching an adjoint solve
+ * backwards in time) the primal solve is repeated from the nearest
+ * earlier snapshot, and the free snapshot slots are filled along the
+ * way following a binomial (revolve) schedule, so that subsequent
+ * retrievals need only short recomputations.  Snapshots later than the
+ * timestep following the one being retrieved during an adjoint solve
+ * are no longer needed and are released.
+ *
+ * The stored vectors can additionally be compressed, see
+ * CompressedHistoryData::Compression.
+ *
+ * Recomputation calls the system \p solve() and the TimeSolver
+ * \p advance_timestep() with the recorded timestep sizes, so it
+ * requires a time solver which honors the system \p deltat, and a
+ * mesh which is unchanged between the primal and adjoint solves.
+ * With \p max_snapshots equal to zero every timestep is kept and no
+ * recomputation is ever done.
+ *
+ * \brief Stores a bounded number of (compressed) past solutions in memory.
+ */
+class CheckpointSolutionHistory : public SolutionHistory
+{
+public:
+
+  /**
+   * Constructor, reference to system to be passed by user.
+   */
+  CheckpointSolutionHistory(DifferentiableSystem & system_,
+                            unsigned int max_snapshots = 0,
+                            CompressedHistoryData::Compression compression = CompressedHistoryData::NONE,
+                            Real tolerance = 0);
+
+  /**
+   * Destructor
+   */
+  ~CheckpointSolutionHistory();
+
+  /**
+   * Virtual function store which we will be overriding to store timesteps
+   */
+  virtual void store(bool is_adjoint_solve, Real time) override;
+
+  /**
+   * Virtual function retrieve which we will be overriding to retrieve timesteps
+   */
+  virtual void retrieve(bool is_adjoint_solve, Real time) override;
+
+  /**
+   * Definition of the clone function needed for the setter function
+   */
+  virtual std::unique_ptr<SolutionHistory > clone() const override
+  {
+    return std::make_unique<CheckpointSolutionHistory>
+      (_system, _max_snapshots, _compression, _tolerance);
+  }
+
+  /**
+   * \returns The number of timesteps currently holding a snapshot.
+   */
+  unsigned int n_snapshots() const;
+
+  /**
+   * \returns The number of bytes currently used by stored snapshots.
+   */
+  std::size_t n_bytes() const;
+
+  /**
+   * \returns The number of primal timesteps which have been
+   * recomputed so far.
+   */
+  unsigned int n_recomputed_steps() const
+  { return _n_recomputed_steps; }
+
+private:
+
+  /**
+   * \returns The data stored at \p it.
+   */
+  static CompressedHistoryData & data(stored_data_iterator it);
+
+  /**
+   * Discards snapshots until at most \p _max_snapshots remain.
+   */
+  void thin_snapshots();
+
+  /**
+   * Recomputes the primal solution up to \p target from the nearest
+   * earlier snapshot.
+   */
+  void recompute(stored_data_iterator target);
+
+  // A system reference
+  DifferentiableSystem & _system;
+
+  unsigned int _max_snapshots;
+
+  CompressedHistoryData::Compression _compression;
+
+  Real _tolerance;
+
+  // Whether we are in the middle of a recomputation, and the time
+  // stamps at which snapshots should be kept while doing it
+  bool _recomputing;
+  std::set<unsigned int> _planned_snapshots;
+
+  unsigned int _n_recomputed_steps;
+};
+
+} // end namespace libMesh
+
+#endif // LIBMESH_CHECKPOINT_SOLUTION_HISTORY_H
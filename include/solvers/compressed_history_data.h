@@ -0,0 +1,150 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_COMPRESSED_HISTORY_DATA_H
+#define LIBMESH_COMPRESSED_HISTORY_DATA_H
+
+#include "libmesh/history_data.h"
+#include "libmesh/diff_system.h"
+
+#include "libmesh/numeric_vector.h"
+
+// C++ includes
+#include <map>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * CompressedHistoryData stores the same set of vectors as
+ * MemoryHistoryData, but keeps only the locally owned entries of each
+ * vector in a packed byte buffer, optionally compressed.  The stored
+ * vectors can be discarded and later re-stored, which lets
+ * CheckpointSolutionHistory keep the timestep metadata of every entry
+ * while holding full solution snapshots for only a few of them.
+ *
+ * This is a companion class to CheckpointSolutionHistory.
+ *
+ * \brief Compressed in-memory storage for one solution history entry.
+ */
+class CompressedHistoryData : public HistoryData
+{
+public:
+
+  /**
+   * How vector entries are encoded.
+   *
+   * NONE copies the raw values.
+   *
+   * LOSSLESS byte-shuffles the values (grouping the sign/exponent
+   * bytes of neighboring entries together) and deflates the result
+   * with zlib when it is available.
+   *
+   * LOSSY rounds every value to the nearest multiple of twice the
+   * user-specified tolerance, so that the absolute error of each
+   * retrieved entry is bounded by that tolerance, and stores the
+   * variable-length encoded differences between consecutive rounded
+   * values before deflating them.  Vectors with entries too large to
+   * be quantized are stored losslessly instead.
+   */
+  enum Compression {NONE = 0,
+                    LOSSLESS,
+                    LOSSY};
+
+  CompressedHistoryData(DifferentiableSystem & system,
+                        Compression compression = NONE,
+                        Real tolerance = 0);
+
+  ~CompressedHistoryData() {}
+
+  virtual void store_initial_solution() override;
+  virtual void store_primal_solution(stored_data_iterator stored_datum) override;
+  virtual void store_adjoint_solution() override;
+  virtual void rewrite_stored_solution() override;
+
+  virtual void retrieve_primal_solution() override;
+  virtual void retrieve_adjoint_solution() override;
+
+  /**
+   * Packs the preserved system vectors and the solution.
+   */
+  void store_vectors();
+
+  /**
+   * Unpacks the stored vectors into the system.
+   */
+  void retrieve_vectors();
+
+  /**
+   * Frees the stored vectors, keeping the time stamp and timestep
+   * size of this entry.
+   */
+  void discard_vectors();
+
+  /**
+   * \returns \p true if this entry currently holds stored vectors.
+   */
+  bool has_vectors() const
+  { return !stored_vecs.empty(); }
+
+  /**
+   * \returns The number of bytes used by the packed vectors.
+   */
+  std::size_t n_bytes() const;
+
+private:
+
+  /**
+   * The locally owned entries of one vector, as packed bytes.
+   */
+  struct PackedVector
+  {
+    numeric_index_type first_local_index = 0;
+    numeric_index_type local_size = 0;
+
+    // The encoding actually used, which may differ from the requested
+    // one, and whether the bytes were deflated afterwards.
+    Compression encoding = NONE;
+    bool deflated = false;
+
+    // The size of the encoded data before deflation
+    std::size_t encoded_size = 0;
+
+    std::vector<unsigned char> bytes;
+  };
+
+  void pack(const NumericVector<Number> & vec, PackedVector & packed) const;
+
+  void unpack(const PackedVector & packed, NumericVector<Number> & vec) const;
+
+  DifferentiableSystem & _system;
+
+  Compression _compression;
+
+  Real _tolerance;
+
+  std::map<std::string, PackedVector> stored_vecs;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_COMPRESSED_HISTORY_DATA_H
@@ -49,6 +49,7 @@ namespace libMesh
 // Forward Declarations
 class Elem;
 class MeshBase;
+class AsyncFileWriter;
 enum XdrMODE : int;
 
 /**
@@ -517,6 +518,18 @@ public:
               bool partition_agnostic = true,
               Xdr * const local_io = nullptr) const;
 
+  /**
+   * Asynchronous version of write().  Any parallel communication and
+   * the serialization of all data into memory is done before this
+   * returns; the files themselves are written by the I/O thread of
+   * \p writer, and are not complete until \p writer.wait() has been
+   * called.  Compressed (.gz, .bz2, .xz) output is not supported.
+   */
+  void write (std::string_view name,
+              AsyncFileWriter & writer,
+              const unsigned int write_flags=(WRITE_DATA),
+              bool partition_agnostic = true) const;
+
   /**
    * \returns \p true when this equation system contains
    * identical data, up to the given threshold.  Delegates
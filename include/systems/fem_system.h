@@ -33,6 +33,7 @@ namespace libMesh
 // Forward Declarations
 class DiffContext;
 class FEMContext;
+class ElemCostTracker;
 
 
 /**
@@ -175,6 +176,13 @@ public:
    */
   bool fe_reinit_during_postprocess;
 
+  /**
+   * If elem_cost_tracker is not null (it is null by default), the
+   * time spent assembling each element is added to its cost in the
+   * tracker, e.g. for use by the DiffusivePartitioner.
+   */
+  ElemCostTracker * elem_cost_tracker;
+
   /**
    * If calculating numeric jacobians is required, the FEMSystem
    * will perturb each solution vector entry by numerical_jacobian_h
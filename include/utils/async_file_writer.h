@@ -0,0 +1,168 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_ASYNC_FILE_WRITER_H
+#define LIBMESH_ASYNC_FILE_WRITER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <condition_variable>
+#include <exception>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class writes files on a background thread, so that
+ * checkpointing code can return to computation as soon as the data
+ * to be written has been serialized into memory.
+ *
+ * Writers such as CheckpointIO and EquationSystems::write() obtain a
+ * buffer for each file they would write from \p stage(), typically
+ * filling it through an in-memory Xdr object, and then call \p
+ * commit() to hand all the staged files to the I/O thread.  The I/O
+ * thread is started by the first commit and lives as long as this
+ * object.  Only one batch of files is in flight at a time: committing
+ * a new batch first waits for the previous one to finish, which
+ * bounds the memory held by staged data.
+ *
+ * Users must call \p wait() (or \p flush()) before relying on the
+ * written files, e.g. before reading them back or before exiting.
+ * Errors encountered by the I/O thread are rethrown from \p wait().
+ *
+ * If libMesh was built without thread support the files are written
+ * synchronously by \p commit().
+ *
+ * \brief Writes staged files in a background thread.
+ */
+class AsyncFileWriter
+{
+public:
+
+  AsyncFileWriter ();
+
+  /**
+   * Destructor.  Waits for any outstanding writes to finish.
+   */
+  ~AsyncFileWriter ();
+
+  /**
+   * This class owns a thread, so it can be neither copied nor moved.
+   */
+  AsyncFileWriter (const AsyncFileWriter &) = delete;
+  AsyncFileWriter & operator= (const AsyncFileWriter &) = delete;
+
+  /**
+   * \returns A buffer to fill with the contents to be written to \p
+   * file_name by the next call to \p commit().  The reference remains
+   * valid until then.
+   */
+  std::vector<char> & stage (const std::string & file_name);
+
+  /**
+   * Starts writing all staged files in the background, after waiting
+   * for any previously committed files to be written.
+   */
+  void commit ();
+
+  /**
+   * Blocks until all committed files have been written.  Throws if
+   * any of them could not be written.
+   */
+  void wait ();
+
+  /**
+   * Synonym for \p wait(), for code which treats this object like an
+   * output stream.
+   */
+  void flush () { this->wait(); }
+
+  /**
+   * \returns The number of bytes staged but not yet committed.
+   */
+  std::size_t n_staged_bytes () const;
+
+private:
+
+  /**
+   * The I/O thread's loop: writes each committed batch until we shut
+   * it down.
+   */
+  void run ();
+
+  /**
+   * Writes the files in \p _writing, saving the first error in \p
+   * _error.
+   */
+  void write_files ();
+
+  typedef std::list<std::pair<std::string, std::vector<char>>> file_list;
+
+  /**
+   * Files staged for the next commit.
+   */
+  file_list _staged;
+
+  /**
+   * Files committed to, or being written by, \p _thread.
+   */
+  file_list _writing;
+
+  /**
+   * The I/O thread, once the first batch has been committed.
+   */
+  std::unique_ptr<Threads::Thread> _thread;
+
+  /**
+   * Protects \p _busy and \p _shutdown, and with \p _cv hands
+   * batches to the I/O thread and tells us when they are written.
+   */
+  std::mutex _mutex;
+  std::condition_variable _cv;
+
+  /**
+   * True from the commit of a batch until the I/O thread has written
+   * it.
+   */
+  bool _busy = false;
+
+  /**
+   * Tells the I/O thread to exit once it is idle.
+   */
+  bool _shutdown = false;
+
+  /**
+   * The first error encountered by the I/O thread, if any.
+   */
+  std::exception_ptr _error;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ASYNC_FILE_WRITER_H
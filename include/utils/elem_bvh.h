@@ -0,0 +1,224 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_BVH_H
+#define LIBMESH_ELEM_BVH_H
+
+// Local Includes
+#include "libmesh/bounding_box.h"
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
+
+// C++ Includes
+#include <array>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class Elem;
+
+/**
+ * A bounding volume hierarchy (BVH) over the bounding boxes of a set
+ * of elements.  Unlike the Trees::OctTree and Trees::QuadTree, each
+ * element is stored exactly once, and the boxes of the tree nodes
+ * adapt to the elements under them, so strongly graded meshes and
+ * thin features don't produce deep or overloaded bins.
+ *
+ * The tree is built top down, splitting each node where the surface
+ * area heuristic (SAH) predicts the cheapest traversal, and the top
+ * levels are split serially before the subtrees below them are built
+ * in parallel across threads.  The nodes are stored in a single flat
+ * vector, with the two children of each node adjacent to each other.
+ *
+ * Besides the point queries used by PointLocatorBVH, the tree supports
+ * box, ray and nearest element queries, e.g. as the search phase for
+ * contact or mortar methods.  All queries work on the element
+ * bounding boxes; deciding whether an element really contains a
+ * point or is hit by a ray is left to the caller.  Queries don't
+ * modify the tree, so they may be made from several threads at once.
+ *
+ * \date 2023
+ * \brief Bounding volume hierarchy over element bounding boxes.
+ */
+class ElemBVH
+{
+public:
+
+  /**
+   * Constructor.  The tree is empty until build() is called.
+   */
+  ElemBVH () = default;
+
+  /**
+   * Builds the tree over \p elems, replacing any previous tree.
+   * Leaves hold at most \p max_leaf_size elements.
+   */
+  void build (const std::vector<const Elem *> & elems,
+              unsigned int max_leaf_size = 4);
+
+  /**
+   * Empties the tree.
+   */
+  void clear ();
+
+  /**
+   * \returns \p true if the tree has no elements.
+   */
+  bool empty () const { return _elems.empty(); }
+
+  /**
+   * \returns The number of elements in the tree.
+   */
+  std::size_t n_elem () const { return _elems.size(); }
+
+  /**
+   * \returns The number of nodes in the tree.
+   */
+  std::size_t n_nodes () const { return _nodes.size(); }
+
+  /**
+   * \returns The bounding box of all the elements in the tree.
+   */
+  const BoundingBox & bounding_box () const;
+
+  /**
+   * \returns The largest Elem::hmax() of the elements in the tree,
+   * for converting relative tolerances into absolute ones.
+   */
+  Real max_hmax () const { return _max_hmax; }
+
+  /**
+   * Appends to \p elems the elements whose bounding boxes intersect
+   * \p box.
+   */
+  void find_elements (const BoundingBox & box,
+                      std::vector<const Elem *> & elems) const;
+
+  /**
+   * Appends to \p elems the elements whose bounding boxes, enlarged by
+   * \p abstol in each direction, contain \p p.
+   */
+  void find_elements (const Point & p,
+                      Real abstol,
+                      std::vector<const Elem *> & elems) const;
+
+  /**
+   * Finds the elements whose bounding boxes are hit by the ray
+   * \p origin + t * \p direction for 0 <= t <= \p t_max.  \p hits is
+   * filled with the value of t at which the ray enters each box, and
+   * the element, in order of increasing t.
+   */
+  void intersect_ray (const Point & origin,
+                      const Point & direction,
+                      std::vector<std::pair<Real, const Elem *>> & hits,
+                      Real t_max = std::numeric_limits<Real>::max()) const;
+
+  /**
+   * A function returning the distance from an element to a point.
+   */
+  typedef std::function<Real (const Elem &, const Point &)> ElemDistance;
+
+  /**
+   * \returns The element nearest to \p p, and sets \p distance to its
+   * distance from \p p, or returns nullptr if the tree is empty.
+   *
+   * By default the distance to an element is the distance to its
+   * bounding box, which is zero for all the elements whose boxes
+   * contain \p p.  A more accurate \p elem_distance can be passed in,
+   * but it must never be smaller than the distance to the element's
+   * bounding box, since that is used to skip parts of the tree.
+   */
+  const Elem * nearest_element (const Point & p,
+                                Real & distance,
+                                const ElemDistance & elem_distance = nullptr) const;
+
+private:
+
+  /**
+   * A node of the tree.
+   */
+  struct BVHNode
+  {
+    /**
+     * The bounding box of all the elements under this node.
+     */
+    BoundingBox box;
+
+    /**
+     * For a leaf, the index of its first element.  Otherwise the
+     * index of the first child, with the second child following it.
+     */
+    dof_id_type first;
+
+    /**
+     * The number of elements in a leaf, or zero for other nodes.
+     */
+    dof_id_type n_elem;
+  };
+
+  /**
+   * Recursively splits the elements in positions [begin, end) of
+   * \p order under node \p n of \p nodes.  If \p deferred is not
+   * null, ranges with no more than \p deferred_size elements are
+   * left as leaves and recorded in it as (node, begin, end), to be
+   * split later.
+   */
+  void build_node (std::vector<BVHNode> & nodes,
+                   dof_id_type n,
+                   std::vector<dof_id_type> & order,
+                   dof_id_type begin,
+                   dof_id_type end,
+                   const std::vector<BoundingBox> & boxes,
+                   const std::vector<Point> & centroids,
+                   unsigned int max_leaf_size,
+                   dof_id_type deferred_size,
+                   std::vector<std::array<dof_id_type, 3>> * deferred) const;
+
+  /**
+   * The nodes of the tree, starting with the root.
+   */
+  std::vector<BVHNode> _nodes;
+
+  /**
+   * The elements, ordered so that the elements of each leaf are
+   * contiguous, and their bounding boxes.
+   */
+  std::vector<const Elem *> _elems;
+  std::vector<BoundingBox> _elem_boxes;
+
+  /**
+   * The largest Elem::hmax() in the tree.
+   */
+  Real _max_hmax = 0;
+
+  /**
+   * Whether to compare boxes by length instead of surface area,
+   * for elements which are all aligned along a line.
+   */
+  bool _use_length = false;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_BVH_H
@@ -23,6 +23,7 @@
 
 // Local includes
 #include "libmesh/libmesh_common.h"
+#include "libmesh/perfmon.h"
 
 // C++ includes
 #include <cstddef>
@@ -32,12 +33,10 @@
 #include <vector>
 #include <deque>
 #include <memory>
-#ifdef LIBMESH_HAVE_SYS_TIME_H
-#include <sys/time.h> // gettimeofday() on Unix
-#endif
-#ifndef LIBMESH_HAVE_GETTIMEOFDAY
-#include "libmesh/win_gettimeofday.h" // gettimeofday() on Windows
-#endif
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
 
 namespace libMesh
 {
@@ -54,6 +53,11 @@ class PerfData
 {
 public:
 
+  /**
+   * The monotonic clock used for all timings.
+   */
+  typedef std::chrono::steady_clock clock_type;
+
   /**
    * Constructor.  Initializes data to be empty.
    */
@@ -65,7 +69,9 @@ public:
     count(0),
     open(false),
     called_recursively(0)
-  {}
+  {
+    counts.fill(0);
+  }
 
 
   /**
@@ -79,16 +85,14 @@ public:
   double tot_time_incl_sub;
 
   /**
-   * Structure defining when the event
-   * was last started.
+   * When the event was last started or resumed.
    */
-  struct timeval tstart;
+  clock_type::time_point tstart;
 
   /**
-   * Structure defining when the event
-   * was last started, including sub-events.
+   * When the event was last started, including sub-events.
    */
-  struct timeval tstart_incl_sub;
+  clock_type::time_point tstart_incl_sub;
 
   /**
    * The number of times this event has
@@ -96,6 +100,13 @@ public:
    */
   unsigned int count;
 
+  /**
+   * Hardware counts during this event, not including sub-events.
+   * These are only collected if the PerfLog has hardware counters
+   * enabled.
+   */
+  PerfMon::counts_type counts;
+
   /**
    * Flag indicating if we are currently
    * monitoring this event.  Should only
@@ -118,6 +129,8 @@ public:
     tot_time += other.tot_time;
     tot_time_incl_sub += other.tot_time_incl_sub;
     count += other.count;
+    for (std::size_t c = 0; c != counts.size(); ++c)
+      counts[c] += other.counts[c];
 
     return *this;
   }
@@ -138,6 +151,14 @@ protected:
  * This class is particularly useful for finding performance
  * bottlenecks.
  *
+ * Besides the flat per-event summary, each thread which logs events
+ * keeps its own call tree, so events logged inside threaded loops are
+ * recorded too, and may optionally keep a trace of every event which
+ * can be exported in the Chrome trace / Perfetto JSON format.  Events
+ * logged by threads other than the one which created the PerfLog, or
+ * inside a threaded region, only appear in the call trees and the
+ * trace, not in the flat summary.
+ *
  * \author Benjamin Kirk
  * \date 2003
  * \brief Responsible for timing and summarizing events.
@@ -201,6 +222,78 @@ public:
    */
   bool summarized_logs_enabled() { return summarize_logs; }
 
+  /**
+   * Tells the PerfLog to print the per-thread call trees after the
+   * flat log results.
+   */
+  void enable_call_tree_logs() { print_call_trees = true; }
+
+  /**
+   * Tells the PerfLog to print only the flat log results (this is
+   * the default behavior)
+   */
+  void disable_call_tree_logs() { print_call_trees = false; }
+
+  /**
+   * \returns \p true iff per-thread call trees will be printed
+   */
+  bool call_tree_logs_enabled() const { return print_call_trees; }
+
+  /**
+   * Starts recording a trace of every event logged from now on, in
+   * addition to the accumulated timings.  The trace grows with every
+   * event logged, so it should only be enabled when it is wanted.
+   */
+  void enable_tracing();
+
+  /**
+   * Stops recording the event trace.  Events already recorded are
+   * kept until clear() is called.
+   */
+  void disable_tracing() { trace_events = false; }
+
+  /**
+   * \returns \p true iff an event trace is being recorded
+   */
+  bool tracing_enabled() const { return trace_events; }
+
+  /**
+   * Starts counting hardware events (cycles, instructions, cache
+   * misses and branch misses) in each event of the flat log.  Reading
+   * the counters costs a system call per push and pop, so this is
+   * off by default.  If the counters are not available, a warning is
+   * printed and they stay disabled.
+   *
+   * This must be called by the thread which created the PerfLog,
+   * since only that thread's events are counted.
+   */
+  void enable_hardware_counters();
+
+  /**
+   * Stops counting hardware events.
+   */
+  void disable_hardware_counters();
+
+  /**
+   * \returns \p true iff hardware events are being counted
+   */
+  bool hardware_counters_enabled() const { return perf_mon.get(); }
+
+  /**
+   * Tells the PerfLog that the thread which created it is about to
+   * run a threaded loop.  Until the matching leave_threaded_region(),
+   * every thread (including this one) logs events only to its own
+   * call tree and trace, and threads which log events are numbered
+   * afresh, so each thread of the loop gets its own row in the
+   * output.  Calls from other threads, and nested calls, are ignored.
+   */
+  void enter_threaded_region();
+
+  /**
+   * Ends a threaded region started with enter_threaded_region().
+   */
+  void leave_threaded_region();
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    *
@@ -305,6 +398,47 @@ public:
    */
   std::string get_perf_info() const;
 
+  /**
+   * \returns A string containing the hardware counts of each event
+   * in the flat log, or an empty string if hardware counters are not
+   * enabled.
+   */
+  std::string get_hardware_counter_info() const;
+
+  /**
+   * \returns A string containing the call tree of events logged by
+   * each thread, with the number of calls and the time spent in each
+   * event both with and without the events it called.
+   *
+   * This should not be called while other threads are logging events.
+   */
+  std::string get_call_tree() const;
+
+  /**
+   * Print the per-thread call trees.
+   */
+  void print_call_tree() const;
+
+  /**
+   * \returns The recorded trace of this processor's events as a
+   * comma-separated sequence of Chrome trace / Perfetto JSON event
+   * objects, with this processor's id as the "pid" and the number of
+   * the logging thread as the "tid".  Timestamps are based on the
+   * system clock, so traces from different processors line up.  The
+   * strings from several processors can be joined with commas and
+   * wrapped in write_trace() style brackets to view them together.
+   *
+   * This should not be called while other threads are logging events.
+   */
+  std::string get_trace_events() const;
+
+  /**
+   * Writes this processor's recorded trace to \p os as a complete
+   * JSON document, which can be loaded by chrome://tracing or
+   * https://ui.perfetto.dev
+   */
+  void write_trace(std::ostream & os) const;
+
   /**
    * Print the log.
    */
@@ -350,6 +484,16 @@ private:
    */
   bool summarize_logs;
 
+  /**
+   * Flag to optionally print the per-thread call trees
+   */
+  bool print_call_trees;
+
+  /**
+   * Flag to optionally record an event trace
+   */
+  bool trace_events;
+
   /**
    * The total running time for recorded events.
    */
@@ -358,7 +502,7 @@ private:
   /**
    * The time we were constructed or last cleared.
    */
-  struct timeval tstart;
+  PerfData::clock_type::time_point tstart;
 
   /**
    * The actual log.
@@ -374,6 +518,159 @@ private:
    */
   std::stack<PerfData*> log_stack;
 
+  /**
+   * Hardware counters for the owner thread, if enabled.
+   */
+  std::unique_ptr<PerfMon> perf_mon;
+
+  /**
+   * The hardware counter totals when they were last attributed to
+   * an event.
+   */
+  PerfMon::counts_type last_counts;
+
+  /**
+   * Attributes the hardware counts since the last call to the event
+   * on top of the stack.
+   */
+  void count_hardware_events() noexcept;
+
+  /**
+   * A node in a thread's call tree.  Node 0 is the root, which
+   * represents no event.
+   */
+  struct CallTreeNode
+  {
+    const char * header;
+    const char * label;
+    std::size_t parent;
+    std::vector<std::size_t> children;
+    unsigned int count;
+    double tot_time_incl_sub;
+  };
+
+  /**
+   * One recorded event in a thread's trace.  The stop time is left
+   * default-constructed until the event ends.
+   */
+  struct TraceEvent
+  {
+    const char * header;
+    const char * label;
+    PerfData::clock_type::time_point start;
+    PerfData::clock_type::time_point stop;
+  };
+
+  /**
+   * The events logged by a single thread: its call tree, the stack of
+   * currently open events, and its trace.
+   */
+  struct ThreadLog
+  {
+    explicit ThreadLog (unsigned int lane_in);
+
+    void push (const char * label, const char * header, bool trace);
+
+    void pop (const char * label, const char * header) noexcept;
+
+    void clear ();
+
+    /**
+     * The number identifying this thread in the output.
+     */
+    const unsigned int lane;
+
+    /**
+     * The threaded region generation in which a thread last claimed
+     * this log.
+     */
+    unsigned long claimed;
+
+    /**
+     * The thread which last claimed this log.
+     */
+    std::thread::id claimer;
+
+    std::vector<CallTreeNode> tree;
+
+    /**
+     * The open events: tree node, start time, and trace entry (or
+     * invalid_trace if the event is not being traced).
+     */
+    struct OpenEvent
+    {
+      std::size_t node;
+      PerfData::clock_type::time_point start;
+      std::size_t trace_index;
+    };
+
+    std::vector<OpenEvent> stack;
+
+    std::vector<TraceEvent> trace;
+
+    static const std::size_t invalid_trace;
+  };
+
+  /**
+   * \returns The log of the calling thread.  If the thread has not
+   * claimed a log yet in the current threaded region generation, one
+   * is claimed if \p claim is true, and nullptr is returned otherwise.
+   */
+  ThreadLog * thread_log(bool claim);
+
+  /**
+   * Per-thread logs.  Entry 0 belongs to the thread which created
+   * this object; other entries are claimed by other threads as they
+   * first log events, and are reused by later threaded regions.
+   */
+  std::vector<std::unique_ptr<ThreadLog>> thread_logs;
+
+  /**
+   * The log of the thread which created this object, thread_logs[0].
+   */
+  ThreadLog * owner_log;
+
+  /**
+   * Protects thread_logs while other threads claim entries.
+   */
+  mutable std::mutex thread_logs_mutex;
+
+  /**
+   * The thread which created this object, which is the only one
+   * logging events to the flat summary.
+   */
+  const std::thread::id owner_thread;
+
+  /**
+   * A number unique to this object, which identifies it in the
+   * per-thread caches of claimed logs.
+   */
+  const unsigned long long serial;
+
+  /**
+   * Incremented whenever a threaded region starts, so threads claim
+   * logs afresh.
+   */
+  std::atomic<unsigned long> generation;
+
+  /**
+   * How deeply the owner thread is nested in threaded regions.  Only
+   * the owner thread changes this, but every logging thread reads it.
+   */
+  std::atomic<unsigned int> threaded_region_depth;
+
+  /**
+   * Trace timestamps are taken with the monotonic clock and reported
+   * relative to this point, which is matched to trace_origin_us on
+   * the system clock.
+   */
+  PerfData::clock_type::time_point trace_origin;
+
+  /**
+   * The system time, in microseconds since the epoch, at trace_origin.
+   */
+  double trace_origin_us;
+
   /**
    * Flag indicating if print_log() has been called.
    * This is used to print a header with machine-specific
@@ -408,7 +705,7 @@ void PerfData::start ()
 {
   this->count++;
   this->called_recursively++;
-  gettimeofday (&(this->tstart), nullptr);
+  this->tstart = clock_type::now();
   this->tstart_incl_sub = this->tstart;
 }
 
@@ -417,7 +714,7 @@ void PerfData::start ()
 inline
 void PerfData::restart ()
 {
-  gettimeofday (&(this->tstart), nullptr);
+  this->tstart = clock_type::now();
 }
 
 
@@ -432,26 +729,18 @@ double PerfData::pause ()
 inline
 double PerfData::stop_or_pause(const bool do_stop)
 {
-  // save the start times, reuse the structure we have rather than create
-  // a new one.
-  const time_t
-    tstart_tv_sec  = this->tstart.tv_sec,
-    tstart_tv_usec = this->tstart.tv_usec;
-
-  gettimeofday (&(this->tstart), nullptr);
+  const clock_type::time_point tnow = clock_type::now();
 
-  const double elapsed_time = (static_cast<double>(this->tstart.tv_sec  - tstart_tv_sec) +
-                               static_cast<double>(this->tstart.tv_usec - tstart_tv_usec)*1.e-6);
+  const double elapsed_time =
+    std::chrono::duration<double>(tnow - this->tstart).count();
 
   this->tot_time += elapsed_time;
 
   if (do_stop)
-    {
-      const double elapsed_time_incl_sub = (static_cast<double>(this->tstart.tv_sec  - this->tstart_incl_sub.tv_sec) +
-                                            static_cast<double>(this->tstart.tv_usec - this->tstart_incl_sub.tv_usec)*1.e-6);
+    this->tot_time_incl_sub +=
+      std::chrono::duration<double>(tnow - this->tstart_incl_sub).count();
 
-      this->tot_time_incl_sub += elapsed_time_incl_sub;
-    }
+  this->tstart = tnow;
 
   return elapsed_time;
 }
@@ -461,10 +750,10 @@ double PerfData::stop_or_pause(const bool do_stop)
 inline
 double PerfData::pause_for(PerfData & other)
 {
-  gettimeofday (&(other.tstart), nullptr);
+  other.tstart = clock_type::now();
 
-  const double elapsed_time = (static_cast<double>(other.tstart.tv_sec  - this->tstart.tv_sec) +
-                               static_cast<double>(other.tstart.tv_usec - this->tstart.tv_usec)*1.e-6);
+  const double elapsed_time =
+    std::chrono::duration<double>(other.tstart - this->tstart).count();
   this->tot_time += elapsed_time;
 
   other.count++;
@@ -494,28 +783,54 @@ inline
 void PerfLog::fast_push (const char * label,
                          const char * header)
 {
-  if (this->log_events)
+  // With logging off we don't even record the call tree
+  if (!this->log_events)
+    return;
+
+  // Only the owner thread outside of threaded regions logs to the
+  // flat summary, and that thread needs no lookup to find its log
+  if (threaded_region_depth.load() ||
+      std::this_thread::get_id() != owner_thread)
     {
-      // Get a reference to the event data to avoid
-      // repeated map lookups
-      PerfData * perf_data = &(log[std::make_pair(header,label)]);
-
-      if (!log_stack.empty())
-        total_time += log_stack.top()->pause_for(*perf_data);
-      else
-        perf_data->start();
-      log_stack.push(perf_data);
+      this->thread_log(true)->push(label, header, this->trace_events);
+      return;
     }
+
+  owner_log->push(label, header, this->trace_events);
+
+  if (perf_mon)
+    this->count_hardware_events();
+
+  // Get a reference to the event data to avoid
+  // repeated map lookups
+  PerfData * perf_data = &(log[std::make_pair(header,label)]);
+
+  if (!log_stack.empty())
+    total_time += log_stack.top()->pause_for(*perf_data);
+  else
+    perf_data->start();
+  log_stack.push(perf_data);
 }
 
 
 
 inline
-void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
-                       const char * libmesh_dbg_var(header)) noexcept
+void PerfLog::fast_pop(const char * label,
+                       const char * header) noexcept
 {
   if (this->log_events)
     {
+      if (threaded_region_depth.load() ||
+          std::this_thread::get_id() != owner_thread)
+        {
+          // A thread without a log has no events to pop
+          if (ThreadLog * tlog = this->thread_log(false))
+            tlog->pop(label, header);
+          return;
+        }
+
+      owner_log->pop(label, header);
+
       // If there's nothing on the stack, then we can't pop anything. Previously we
       // asserted that the log_stack was not empty, but we should not throw from
       // this function, so instead just return in that case.
@@ -574,6 +889,9 @@ void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
         }
 #endif
 
+      if (perf_mon)
+        this->count_hardware_events();
+
       // In optimized mode, we just pop from the top of the stack and
       // resume timing the next entry.
       total_time += log_stack.top()->stopit();
@@ -590,13 +908,8 @@ void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
 inline
 double PerfLog::get_elapsed_time () const
 {
-  struct timeval tnow;
-
-  gettimeofday (&tnow, nullptr);
-
-  const double elapsed_time = (static_cast<double>(tnow.tv_sec  - tstart.tv_sec) +
-                               static_cast<double>(tnow.tv_usec - tstart.tv_usec)*1.e-6);
-  return elapsed_time;
+  return std::chrono::duration<double>
+    (PerfData::clock_type::now() - tstart).count();
 }
 
 inline
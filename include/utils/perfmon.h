@@ -24,21 +24,11 @@
 // Local includes
 #include "libmesh/libmesh_common.h"
 
-#ifdef HAVE_PAPI_H
-namespace Papi {
-#  include <papi.h>
-}
-#endif
-
 // C++ includes
+#include <array>
+#include <chrono>
 #include <cstddef>
 #include <string>
-#ifdef LIBMESH_HAVE_SYS_TIME_H
-#include <sys/time.h> // gettimeofday() on Unix
-#endif
-#ifndef LIBMESH_HAVE_GETTIMEOFDAY
-#include "libmesh/win_gettimeofday.h" // gettimeofday() on Windows
-#endif
 
 namespace libMesh
 {
@@ -46,9 +36,19 @@ namespace libMesh
 
 
 /**
- * PAPI stands for Performance Application Programming Interface.
- * This class was supposed to provide an interface to the hardware
- * timers that PAPI exposes, but it never really got developed.
+ * The PerfMon class reports elapsed time and, where the operating
+ * system allows it, hardware performance counters for the thread
+ * which created it.
+ *
+ * On Linux the counters are read through the perf_event_open()
+ * system call, so no external library is needed.  The kernel may
+ * forbid unprivileged access to the counters (see
+ * /proc/sys/kernel/perf_event_paranoid), and virtual machines often
+ * do not expose them; in those cases counters_available() returns
+ * false and only times are reported.  Counters which the hardware
+ * does not support read as zero.
+ *
+ * Only user-space events of the creating thread are counted.
  *
  * \author Benjamin S. Kirk
  * \date 2002
@@ -57,117 +57,122 @@ namespace libMesh
 class PerfMon
 {
 public:
+  /**
+   * The hardware events counted.
+   */
+  enum Counter { CYCLES = 0,
+                 INSTRUCTIONS,
+                 CACHE_MISSES,
+                 BRANCH_MISSES,
+                 N_COUNTERS };
+
+  /**
+   * A set of counts, indexed by Counter.
+   */
+  typedef std::array<unsigned long long, N_COUNTERS> counts_type;
+
+  /**
+   * Constructor.  Starts timing and counting.  \p id labels the
+   * output; nothing is printed unless \p v is nonzero and \p pid
+   * is zero.
+   */
   PerfMon  (std::string id,
             const unsigned int v=1,
             const unsigned int pid=0);
 
+  /**
+   * This class owns the counter file descriptors, which it closes on
+   * destruction, so it can be neither copied nor moved.
+   */
+  PerfMon (const PerfMon &) = delete;
+  PerfMon & operator= (const PerfMon &) = delete;
+
+  /**
+   * Destructor.  Prints the results, if verbose.
+   */
   ~PerfMon ();
+
+  /**
+   * Restarts timing and counting from zero.
+   */
   void reset ();
+
+  /**
+   * Prints the elapsed time and counts since the last reset(), if
+   * verbose, labelled with \p msg or with the id if \p msg is
+   * "NULL".
+   *
+   * \returns The elapsed time in seconds.
+   */
   double print (std::string msg="NULL",
                 std::ostream & my_out = libMesh::out);
 
+  /**
+   * \returns \p true iff hardware counters could be opened.
+   */
+  bool counters_available () const { return _group_fd != -1; }
+
+  /**
+   * \returns The running totals of the hardware counters, which
+   * only mean anything as differences between two calls.  This costs
+   * one system call.  All counts are zero if counters are not
+   * available.
+   */
+  counts_type read_counters () const;
+
+  /**
+   * \returns The counts since the last reset().
+   */
+  counts_type counters () const;
+
+  /**
+   * \returns A short name for counter \p c.
+   */
+  static const char * counter_name (Counter c);
+
 private:
 
+  /**
+   * Opens the hardware counters, if possible.
+   */
+  void open_counters ();
+
   const std::string id_string;
 
-  struct timeval the_time_start;
-  struct timeval the_time_stop;
+  std::chrono::steady_clock::time_point the_time_start;
 
   const unsigned int verbose;
   const unsigned int proc_id;
 
-#ifdef HAVE_PAPI_H
-  float rtime, ptime, mflops;
-  long long int flpins;
-#endif
+  /**
+   * The file descriptor of the counter group leader, or -1 if the
+   * counters could not be opened.
+   */
+  int _group_fd;
+
+  /**
+   * File descriptors of the other counters in the group.
+   */
+  std::array<int, N_COUNTERS> _fds;
+
+  /**
+   * For each counter, its position in the values read from the
+   * group, or -1 if that counter could not be opened.
+   */
+  std::array<int, N_COUNTERS> _slot;
+
+  /**
+   * The number of counters in the group.
+   */
+  unsigned int _n_open;
+
+  /**
+   * The counter totals at the last reset().
+   */
+  counts_type _start_counts;
 };
 
 
-
-inline
-void
-PerfMon::reset ()
-{
-  gettimeofday (&the_time_start, nullptr);
-
-#ifdef HAVE_PAPI_H
-  Papi::PAPI_flops (&rtime, & ptime, &flpins, &mflops);
-#endif
-}
-
-
-
-inline
-double
-PerfMon::print (std::string msg, std::ostream & my_out)
-{
-  gettimeofday (&the_time_stop, nullptr);
-
-#ifdef HAVE_PAPI_H
-  Papi::PAPI_flops (&rtime, & ptime, &flpins, &mflops);
-#endif
-
-  const double elapsed_time = ((double) (the_time_stop.tv_sec - the_time_start.tv_sec)) +
-    ((double) (the_time_stop.tv_usec - the_time_start.tv_usec))/1000000.;
-
-  if (verbose)
-    {
-
-      if (proc_id == 0)
-        {
-          if (msg == "NULL")
-            my_out << " " << id_string
-                   << ": elapsed time: "
-                   << elapsed_time << " (sec)"
-                   << std::endl;
-          else
-            my_out << " " << msg
-                   << ": elapsed time: "
-                   << elapsed_time << " (sec)"
-                   << std::endl;
-
-#ifdef HAVE_PAPI_H
-          if (msg == "NULL")
-            my_out << " " << id_string
-                   << ": mflops: "
-                   << mflops
-                   << std::endl;
-          else
-            my_out << " " << msg
-                   << ": mflops: "
-                   << mflops
-                   << std::endl;
-#endif
-
-        }
-    }
-
-  return elapsed_time;
-}
-
-
-inline
-PerfMon::PerfMon (std::string id,
-                  const unsigned int v,
-                  const unsigned int pid) :
-  id_string(id),
-  verbose(v),
-  proc_id(pid)
-{
-  reset ();
-}
-
-
-
-inline
-PerfMon::~PerfMon ()
-{
-  print ();
-}
-
-
-
-
 } // namespace libMesh
 
 
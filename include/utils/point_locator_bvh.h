@@ -0,0 +1,133 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_POINT_LOCATOR_BVH_H
+#define LIBMESH_POINT_LOCATOR_BVH_H
+
+// Local Includes
+#include "libmesh/point_locator_base.h"
+
+// C++ includes
+#include <memory>
+#include <set>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class ElemBVH;
+class MeshBase;
+class Point;
+class Elem;
+
+/**
+ * This is a PointLocator that uses an ElemBVH, a bounding volume
+ * hierarchy over the bounding boxes of the active elements, for its
+ * implementation.  Each element is stored in the tree once, however
+ * much its size differs from its neighbors', so it holds up better
+ * than the Tree-based PointLocator on strongly graded meshes.
+ *
+ * The tree is shared with any PointLocatorBVH built with this one as
+ * its master, and is available through bvh() for box, ray and
+ * nearest element queries.
+ *
+ * \date 2023
+ * \brief PointLocator based on a bounding volume hierarchy.
+ */
+class PointLocatorBVH : public PointLocatorBase
+{
+public:
+  /**
+   * Constructor. Needs the \p mesh in which the points should be
+   * located. Optionally takes a pointer to a "master" PointLocator
+   * object. If non-nullptr, this object simply forwards its calls
+   * onto the master, so we can have multiple pointers that use the
+   * same tree.
+   */
+  PointLocatorBVH (const MeshBase & mesh,
+                   const PointLocatorBase * master = nullptr);
+
+  /**
+   * Destructor.
+   */
+  virtual ~PointLocatorBVH ();
+
+  /**
+   * Restore to PointLocator to a just-constructed state.
+   */
+  virtual void clear() override final;
+
+  /**
+   * Initializes the locator, so that the \p operator() methods can
+   * be used.
+   */
+  virtual void init() override final;
+
+  /**
+   * Locates the element in which the point with global coordinates \p
+   * p is located, optionally restricted to a set of allowed
+   * subdomains.  If several elements contain \p p, the one with the
+   * lowest id is returned.
+   */
+  virtual const Elem * operator() (const Point & p,
+                                   const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override final;
+
+  /**
+   * Locates the elements which contain the point with global
+   * coordinates \p p, to within the close-to-point tolerance,
+   * optionally restricted to a set of allowed subdomains.
+   */
+  virtual void operator() (const Point & p,
+                           std::set<const Elem *> & candidate_elements,
+                           const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override final;
+
+  /**
+   * Enables out-of-mesh mode. In this mode, if a searched-for Point
+   * is not contained in any element of the Mesh, return nullptr
+   * instead of throwing an error. By default, this mode is off.
+   */
+  virtual void enable_out_of_mesh_mode () override final;
+
+  /**
+   * Disables out-of-mesh mode (default). See above.
+   */
+  virtual void disable_out_of_mesh_mode () override final;
+
+  /**
+   * \returns The tree of element bounding boxes.
+   */
+  const ElemBVH & bvh () const;
+
+protected:
+
+  /**
+   * \p true if out-of-mesh mode is enabled.  See \p
+   * enable_out_of_mesh_mode() for details.
+   */
+  bool _out_of_mesh_mode;
+
+  /**
+   * The tree, shared with the master if we are not the master.
+   */
+  std::shared_ptr<ElemBVH> _bvh;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_POINT_LOCATOR_BVH_H
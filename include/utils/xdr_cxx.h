@@ -86,6 +86,14 @@ public:
    */
   Xdr (std::istream & stream);
 
+  /**
+   * In-memory constructor.  Valid modes are ENCODE and WRITE.  The
+   * encoded or written data is copied into \p buffer when the Xdr
+   * object is closed (or destroyed), so that it can later be written
+   * to a file verbatim, e.g. by an AsyncFileWriter.
+   */
+  Xdr (std::vector<char> & buffer, const XdrMODE m);
+
   /**
    * Destructor.  Closes the file if it is open.
    */
@@ -278,6 +286,19 @@ private:
    * Version of the file being read
    */
   int version_number;
+
+  /**
+   * Where to copy our data when closing an in-memory Xdr object.
+   */
+  std::vector<char> * buffer_target = nullptr;
+
+#ifdef LIBMESH_HAVE_XDR
+  /**
+   * The memory stream backing \p fp for in-memory encoding.
+   */
+  char * mem_buffer = nullptr;
+  std::size_t mem_size = 0;
+#endif
 };
 
 
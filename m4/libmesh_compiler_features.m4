@@ -164,6 +164,8 @@ AC_CHECK_HEADERS(sys/time.h)
 AC_CHECK_HEADERS(process.h)
 AC_CHECK_HEADERS(csignal)
 AC_CHECK_HEADERS(sys/resource.h)
+AC_CHECK_HEADERS(sys/mman.h)
+AC_CHECK_HEADERS(linux/perf_event.h)
 AC_CXX_HAVE_LOCALE
 AC_CXX_HAVE_SSTREAM
 
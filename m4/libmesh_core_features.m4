@@ -121,6 +121,25 @@ AS_IF([test "$enableblockedstorage" != no],
 # --------------------------------------------------------------
 
 
+# --------------------------------------------------------------
+# reproducible reductions - disabled by default.
+#   Threaded vector reductions are split into fixed size chunks
+#   rather than one chunk per thread, so that results do not depend
+#   on the number of threads.
+# --------------------------------------------------------------
+AC_ARG_ENABLE(reproducible-reductions,
+              [AS_HELP_STRING([--enable-reproducible-reductions],[Make threaded vector reductions independent of the number of threads])],
+              enablereproduciblereductions=$enableval,
+              enablereproduciblereductions=no)
+
+AS_IF([test "$enablereproduciblereductions" != no],
+      [
+        AC_MSG_RESULT([<<< Configuring library for reproducible threaded reductions >>>])
+        AC_DEFINE(ENABLE_REPRODUCIBLE_REDUCTIONS, 1, [Flag indicating if threaded vector reductions should be independent of the number of threads])
+      ])
+# --------------------------------------------------------------
+
+
 # --------------------------------------------------------------
 # legacy include paths - disabled by default
 # --------------------------------------------------------------
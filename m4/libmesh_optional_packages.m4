@@ -154,6 +154,15 @@ AS_IF([test "$enablexdr" != no],
 AS_IF([test "x$enablexdr" = "xno" && test "x$xdrrequired" = "xyes"],
       [AC_MSG_ERROR([*** XDR was not found, but --enable-xdr-required was specified.], 4)])
 
+dnl In-memory XDR encoding, e.g. for AsyncFileWriter, uses the POSIX
+dnl open_memstream() where it is available, and a temporary file
+dnl otherwise.
+AS_IF([test "x$enablexdr" = "xyes"],
+      [
+        AC_CHECK_FUNC([open_memstream],
+                      [AC_DEFINE(HAVE_OPEN_MEMSTREAM, 1, [Flag indicating whether open_memstream() is available])])
+      ])
+
 # -------------------------------------------------------------
 
 
@@ -6,10 +6,13 @@
 
 // libMesh includes
 #include <libmesh/parallel.h>
+#include <libmesh/threads.h>
 
 #include "libmesh_cppunit.h"
 
+#include <cmath>
 #include <memory>
+#include <tuple>
 
 #define NUMERICVECTORTEST                       \
   CPPUNIT_TEST( testLocalize );                 \
@@ -176,6 +179,84 @@ public:
                             libMesh::TOLERANCE*libMesh::TOLERANCE);
   }
 
+  template <class Base, class Derived>
+  void ThreadedReductions()
+  {
+    auto v_ptr = std::make_unique<Derived>(*my_comm, global_size, local_size);
+    Base & v = *v_ptr;
+    auto w_ptr = std::make_unique<Derived>(*my_comm, global_size, local_size);
+    Base & w = *w_ptr;
+
+    const libMesh::dof_id_type
+      first = v.first_local_index(),
+      last  = v.last_local_index();
+
+    // Values of widely varying magnitude, so that summing them in a
+    // different order would round differently
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      {
+        v.set (n, static_cast<libMesh::Number>(std::sin(libMesh::Real(n)) * (n%7+1) * 1e3));
+        w.set (n, static_cast<libMesh::Number>(1/libMesh::Real(n+1) - libMesh::Real(0.25)));
+      }
+    v.close();
+    w.close();
+
+    auto reduce = [&v, &w]()
+      {
+        return std::make_tuple(v.dot(w), v.l2_norm(), v.sum(), w.sum());
+      };
+
+    // Run the reductions as if from within a threaded region, where
+    // the kernels work through their chunks on the calling thread,
+    // and then with however many threads --n-threads gave us
+    decltype(reduce()) serial;
+    {
+      libMesh::Threads::BoolAcquire b(libMesh::Threads::in_threads);
+      serial = reduce();
+    }
+    const auto threaded = reduce();
+
+    // The results should be bitwise identical
+    CPPUNIT_ASSERT(std::get<0>(serial) == std::get<0>(threaded));
+    CPPUNIT_ASSERT(std::get<1>(serial) == std::get<1>(threaded));
+    CPPUNIT_ASSERT(std::get<2>(serial) == std::get<2>(threaded));
+    CPPUNIT_ASSERT(std::get<3>(serial) == std::get<3>(threaded));
+  }
+
+  template <class Base, class Derived>
+  void PointwiseOperations()
+  {
+    auto v_ptr = std::make_unique<Derived>(*my_comm, global_size, local_size);
+    Base & v = *v_ptr;
+
+    const libMesh::dof_id_type
+      first = v.first_local_index(),
+      last  = v.last_local_index();
+
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      v.set (n, static_cast<libMesh::Number>(n+1));
+    v.close();
+
+    auto w_ptr = v.clone();
+    auto & w = *w_ptr;
+    w.add(1);
+
+    auto u_ptr = v.zero_clone();
+    auto & u = *u_ptr;
+
+    u.pointwise_mult(v, w);
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(u(n)),
+                              libMesh::Real((n+1)*(n+2)),
+                              libMesh::TOLERANCE*libMesh::TOLERANCE);
+
+    u.pointwise_divide(u, v);
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(u(n)),
+                              libMesh::Real(n+2),
+                              libMesh::TOLERANCE*libMesh::TOLERANCE);
+  }
+
   template <class Base, class Derived>
   void Localize(bool to_one=false)
   {
@@ -329,6 +410,41 @@ public:
     Norms<libMesh::NumericVector<libMesh::Number>,DerivedClass>();
   }
 
+  void testPointwiseOperations()
+  {
+    LOG_UNIT_TEST;
+
+    PointwiseOperations<DerivedClass,DerivedClass>();
+  }
+
+  void testLargeNorms()
+  {
+    LOG_UNIT_TEST;
+
+    // Enough entries for the vector kernels to split the work
+    block_size = 100000;
+    local_size = block_size + static_cast<unsigned int>(my_comm->rank());
+    global_size = 0;
+    for (libMesh::processor_id_type p=0; p<my_comm->size(); p++)
+      global_size += (block_size + static_cast<unsigned int>(p));
+
+    Norms<DerivedClass,DerivedClass>();
+  }
+
+  void testReproducibleReductions()
+  {
+    LOG_UNIT_TEST;
+
+    // Enough entries for the vector kernels to use many chunks
+    block_size = 100000;
+    local_size = block_size + static_cast<unsigned int>(my_comm->rank());
+    global_size = 0;
+    for (libMesh::processor_id_type p=0; p<my_comm->size(); p++)
+      global_size += (block_size + static_cast<unsigned int>(p));
+
+    ThreadedReductions<DerivedClass,DerivedClass>();
+  }
+
   void testOperations()
   {
     LOG_UNIT_TEST;